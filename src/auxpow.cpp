@@ -112,6 +112,14 @@ bool CAuxPow::check (const uint256& hashAuxBlock, int nChainId,
     return true;
 }
 
+uint256
+CAuxPow::getCommitmentHash () const
+{
+    HashWriter hasher{};
+    hasher << coinbaseTx->GetHash () << vMerkleBranch << vChainMerkleBranch << nChainIndex << parentBlock;
+    return hasher.GetHash ();
+}
+
 int
 CAuxPow::getExpectedIndex (const uint32_t &nNonce, const int &nChainId,
                            const unsigned &h)
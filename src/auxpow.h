@@ -119,6 +119,13 @@ public:
     return parentBlock.GetHash ();
   }
 
+  /**
+   * Returns a hash committing to everything check() and the parent PoW
+   * check look at.  The coinbase is covered by its txid, which has been
+   * computed already when deserialising it.
+   */
+  uint256 getCommitmentHash () const;
+
   inline uint256
   getParentPrevBlockHash () const
   {
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 The Syscoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <auxpowtag.h>
+
+#include <crypto/common.h>
+#include <primitives/transaction.h>
+#include <script/script.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+void WritePayload(unsigned char* out, const uint256& hash, uint32_t nHeight)
+{
+    std::copy(hash.begin(), hash.end(), out);
+    WriteLE32(out + hash.size(), nHeight);
+}
+} // namespace
+
+std::vector<unsigned char> EncodeSyscoinAuxpowTag(const uint256& hash, uint32_t nHeight)
+{
+    std::vector<unsigned char> vchTag(SYSCOIN_TAG_SIZE);
+    std::copy(std::begin(pchSyscoinHeader), std::end(pchSyscoinHeader), vchTag.begin());
+    WritePayload(vchTag.data() + sizeof(pchSyscoinHeader), hash, nHeight);
+    return vchTag;
+}
+
+std::optional<size_t> FindBytes(Span<const unsigned char> haystack, Span<const unsigned char> needle)
+{
+    if (needle.empty()) return 0;
+    if (haystack.size() < needle.size()) return std::nullopt;
+    const unsigned char* const begin = haystack.data();
+    // last position a full needle can start at
+    const unsigned char* const last = begin + (haystack.size() - needle.size());
+    const unsigned char* pc = begin;
+    while (pc <= last) {
+        // memchr skips ahead to the next candidate first byte, far faster than a bytewise loop
+        pc = static_cast<const unsigned char*>(std::memchr(pc, needle[0], last - pc + 1));
+        if (pc == nullptr) return std::nullopt;
+        if (std::memcmp(pc + 1, needle.data() + 1, needle.size() - 1) == 0) {
+            return pc - begin;
+        }
+        ++pc;
+    }
+    return std::nullopt;
+}
+
+std::vector<SyscoinAuxpowTag> ScanSyscoinAuxpowTags(const CTransaction& coinbaseTx)
+{
+    std::vector<SyscoinAuxpowTag> tags;
+    for (size_t i = 0; i < coinbaseTx.vout.size(); ++i) {
+        const CScript& script = coinbaseTx.vout[i].scriptPubKey;
+        if (!script.IsUnspendable()) continue;
+        const auto pos = FindBytes(script, pchSyscoinHeader);
+        if (!pos) continue;
+        SyscoinAuxpowTag& tag = tags.emplace_back();
+        tag.nOutput = i;
+        tag.nMarkerPos = *pos;
+        const size_t nPayloadPos = *pos + sizeof(pchSyscoinHeader);
+        if (script.size() - nPayloadPos >= SYSCOIN_TAG_PAYLOAD_SIZE) {
+            const unsigned char* const payload = script.data() + nPayloadPos;
+            std::copy(payload, payload + tag.hash.size(), tag.hash.begin());
+            tag.nHeight = ReadLE32(payload + tag.hash.size());
+            tag.fComplete = true;
+        }
+    }
+    return tags;
+}
+
+bool SyscoinAuxpowTagMatches(const CScript& script, const SyscoinAuxpowTag& tag, const uint256& hash, uint32_t nHeight)
+{
+    if (tag.fComplete && tag.hash == hash && tag.nHeight == nHeight) {
+        return true;
+    }
+    unsigned char payload[SYSCOIN_TAG_PAYLOAD_SIZE];
+    WritePayload(payload, hash, nHeight);
+    const size_t nPayloadPos = tag.nMarkerPos + sizeof(pchSyscoinHeader);
+    if (nPayloadPos > script.size()) return false;
+    return FindBytes(Span{script}.subspan(nPayloadPos), payload).has_value();
+}
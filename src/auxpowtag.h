@@ -0,0 +1,55 @@
+// Copyright (c) 2026 The Syscoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SYSCOIN_AUXPOWTAG_H
+#define SYSCOIN_AUXPOWTAG_H
+
+#include <auxpow.h>
+#include <span.h>
+#include <uint256.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+class CScript;
+class CTransaction;
+
+/** Size of the data following pchSyscoinHeader: the referenced block hash and its height (LE) */
+static constexpr size_t SYSCOIN_TAG_PAYLOAD_SIZE{32 + 4};
+static constexpr size_t SYSCOIN_TAG_SIZE{sizeof(pchSyscoinHeader) + SYSCOIN_TAG_PAYLOAD_SIZE};
+
+/**
+ * The Syscoin tag found in one unspendable output of a parent chain coinbase. Only the first
+ * pchSyscoinHeader marker of a script counts, the referenced block is read right after it.
+ */
+struct SyscoinAuxpowTag
+{
+    //! index of the coinbase output carrying the tag
+    size_t nOutput{0};
+    //! position of the marker in the scriptPubKey
+    size_t nMarkerPos{0};
+    //! false if the script ends before a complete payload follows the marker
+    bool fComplete{false};
+    uint256 hash;
+    uint32_t nHeight{0};
+};
+
+/** Marker followed by hash and height, as miners commit it in an OP_RETURN output */
+std::vector<unsigned char> EncodeSyscoinAuxpowTag(const uint256& hash, uint32_t nHeight);
+
+/** Position of the first occurrence of needle in haystack */
+std::optional<size_t> FindBytes(Span<const unsigned char> haystack, Span<const unsigned char> needle);
+
+/** Scan each unspendable output of the parent coinbase once for the Syscoin tag, in output order */
+std::vector<SyscoinAuxpowTag> ScanSyscoinAuxpowTags(const CTransaction& coinbaseTx);
+
+/**
+ * Whether the tag found in script commits to the given block. The payload right after the marker
+ * is compared first, scripts placing it further behind the marker are searched as before.
+ */
+bool SyscoinAuxpowTagMatches(const CScript& script, const SyscoinAuxpowTag& tag, const uint256& hash, uint32_t nHeight);
+
+#endif // SYSCOIN_AUXPOWTAG_H
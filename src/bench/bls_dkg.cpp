@@ -7,6 +7,8 @@
 #include <random.h>
 #include <boost/range/irange.hpp>
 
+#include <future>
+
 struct Member {
     CBLSId id;
 
@@ -105,6 +107,41 @@ public:
             memberIdx = (memberIdx + 1) % members.size();
         });
     }
+
+    // Models how CDKGSession verifies contributions while they arrive: every batchSize received shares are
+    // handed to the worker right away and only the results are collected at the end of the phase
+    void Bench_VerifyContributionSharesPipelined(benchmark::Bench& bench, int invalidCount, size_t batchSize, uint32_t epoch_iters)
+    {
+        ReceiveVvecs();
+        size_t memberIdx = 0;
+        bench.minEpochIterations(epoch_iters).run([&] {
+            ReceiveShares(memberIdx);
+
+            std::set<size_t> invalidIndexes;
+            for ([[maybe_unused]] const auto _ : boost::irange(invalidCount)) {
+                int shareIdx = GetRandInternal(receivedSkShares.size());
+                receivedSkShares[shareIdx].MakeNewKey();
+                invalidIndexes.emplace(shareIdx);
+            }
+
+            std::vector<std::pair<size_t, std::future<std::vector<bool>>>> futures;
+            for (size_t start = 0; start < receivedSkShares.size(); start += batchSize) {
+                const size_t count = std::min(batchSize, receivedSkShares.size() - start);
+                futures.emplace_back(start, blsWorker.AsyncVerifyContributionShares(members[memberIdx].id,
+                                                                                   Span{receivedVvecs}.subspan(start, count),
+                                                                                   Span{receivedSkShares}.subspan(start, count),
+                                                                                   true, true));
+            }
+            for (auto& [start, future] : futures) {
+                const auto result = future.get();
+                for (const size_t i : boost::irange(result.size())) {
+                    assert(result[i] == !invalidIndexes.count(start + i));
+                }
+            }
+
+            memberIdx = (memberIdx + 1) % members.size();
+        });
+    }
 };
 
 static void BLSDKG_GenerateContributions(benchmark::Bench& bench, uint32_t epoch_iters, int quorumSize)
@@ -186,6 +223,21 @@ static void BLSDKG_InitDKG(benchmark::Bench& bench, uint32_t epoch_iters, int qu
     } \
     BENCHMARK(BLSDKG_VerifyContributionShares_##name##_##quorumSize, benchmark::PriorityLevel::HIGH)
 
+#define BENCH_VerifyContributionSharesPipelined(name, quorumSize, invalidCount, epoch_iters) \
+    static void BLSDKG_VerifyContributionShares_##name##_##quorumSize(benchmark::Bench& bench) \
+    { \
+        if (!bench.output()) { \
+            std::unique_ptr<DKG> ptr = std::make_unique<DKG>(1); \
+            ptr->Bench_VerifyContributionSharesPipelined(bench, invalidCount, 8, 1); \
+            ptr.reset(); \
+            return; \
+        } \
+        std::unique_ptr<DKG> ptr = std::make_unique<DKG>(quorumSize); \
+        ptr->Bench_VerifyContributionSharesPipelined(bench, invalidCount, 8, epoch_iters); \
+        ptr.reset(); \
+    } \
+    BENCHMARK(BLSDKG_VerifyContributionShares_##name##_##quorumSize, benchmark::PriorityLevel::HIGH)
+
 BENCH_GenerateContributions(simple, 50, 50);
 BENCH_GenerateContributions(simple, 100, 5);
 
@@ -203,3 +255,5 @@ BENCH_VerifyContributionShares(simple, 400, 5, false, 1)
 BENCH_VerifyContributionShares(aggregated, 10, 5, true, 100)
 BENCH_VerifyContributionShares(aggregated, 100, 5, true, 10)
 BENCH_VerifyContributionShares(aggregated, 400, 5, true, 1)
+BENCH_VerifyContributionSharesPipelined(pipelined, 100, 5, 10)
+BENCH_VerifyContributionSharesPipelined(pipelined, 400, 5, 1)
@@ -72,6 +72,31 @@ public:
     }
 };
 
+// SYSCOIN
+/** getpodablobs: PoDA blobs of a block's transactions, by version hash, that we could not fill from our blob store */
+class PoDABlobsRequest {
+public:
+    uint256 blockhash;
+    std::vector<std::vector<uint8_t>> vecVersionHashes;
+
+    SERIALIZE_METHODS(PoDABlobsRequest, obj)
+    {
+        READWRITE(obj.blockhash, obj.vecVersionHashes);
+    }
+};
+
+/** podablobs: the blobs asked for by a getpodablobs, in request order. A blob the sender does not have is sent empty. */
+class PoDABlobs {
+public:
+    uint256 blockhash;
+    std::vector<NEVMDataBlobRef> vecBlobs;
+
+    SERIALIZE_METHODS(PoDABlobs, obj)
+    {
+        READWRITE(obj.blockhash, Using<VectorFormatter<NEVMDataBlobFormatter>>(obj.vecBlobs));
+    }
+};
+
 // Dumb serialization/storage-helper for CBlockHeaderAndShortTxIDs and PartiallyDownloadedBlock
 struct PrefilledTransaction {
     // Used as an offset since last prefilled tx in CBlockHeaderAndShortTxIDs,
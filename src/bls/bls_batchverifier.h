@@ -81,45 +81,64 @@ public:
             return;
         }
 
-        // revert to per-source verification
-        for (const auto& p : messagesBySource) {
-            bool batchValid = false;
-
-            // no need to verify it again if there was just one source
-            if (messagesBySource.size() != 1) {
-                byMessageHash.clear();
-                for (auto it = p.second.begin(); it != p.second.end(); ++it) {
-                    byMessageHash[(*it)->second.msgHash].emplace_back(*it);
+        // bisect the sources, so that a few bad sources in a large batch only cost a few extra batches each instead
+        // of one batch per source
+        std::vector<typename MessagesBySourceMap::const_iterator> sources;
+        sources.reserve(messagesBySource.size());
+        for (auto it = messagesBySource.cbegin(); it != messagesBySource.cend(); ++it) {
+            sources.emplace_back(it);
+        }
+        BisectSources(sources, 0, sources.size());
+    }
+
+private:
+    // The sources in [begin, end) are known to contain at least one bad message
+    void BisectSources(const std::vector<typename MessagesBySourceMap::const_iterator>& sources, size_t begin, size_t end)
+    {
+        if (end - begin == 1) {
+            MarkBadSource(*sources[begin]);
+            return;
+        }
+        const size_t mid = begin + (end - begin) / 2;
+        // both halves are verified, a valid half doesn't prove that the other one is invalid when they share messages
+        for (const auto& [first, last] : {std::make_pair(begin, mid), std::make_pair(mid, end)}) {
+            std::map<uint256, std::vector<MessageMapIterator>> byMessageHash;
+            for (size_t i = first; i < last; ++i) {
+                for (const auto& msgIt : sources[i]->second) {
+                    byMessageHash[msgIt->second.msgHash].emplace_back(msgIt);
                 }
-                batchValid = VerifyBatch(byMessageHash);
             }
-            if (!batchValid) {
-                badSources.emplace(p.first);
-
-                if (perMessageFallback) {
-                    // revert to per-message verification
-                    if (p.second.size() == 1) {
-                        // no need to re-verify a single message
-                        badMessages.emplace(p.second[0]->second.msgId);
-                    } else {
-                        for (const auto& msgIt : p.second) {
-                            if (badMessages.count(msgIt->first)) {
-                                // same message might be invalid from different source, so no need to re-verify it
-                                continue;
-                            }
-
-                            const auto& msg = msgIt->second;
-                            if (!msg.sig.VerifyInsecure(msg.pubKey, msg.msgHash)) {
-                                badMessages.emplace(msg.msgId);
-                            }
-                        }
+            if (!VerifyBatch(byMessageHash)) {
+                BisectSources(sources, first, last);
+            }
+        }
+    }
+
+    void MarkBadSource(const typename MessagesBySourceMap::value_type& p)
+    {
+        badSources.emplace(p.first);
+
+        if (perMessageFallback) {
+            // revert to per-message verification
+            if (p.second.size() == 1) {
+                // no need to re-verify a single message
+                badMessages.emplace(p.second[0]->second.msgId);
+            } else {
+                for (const auto& msgIt : p.second) {
+                    if (badMessages.count(msgIt->first)) {
+                        // same message might be invalid from different source, so no need to re-verify it
+                        continue;
+                    }
+
+                    const auto& msg = msgIt->second;
+                    if (!msg.sig.VerifyInsecure(msg.pubKey, msg.msgHash)) {
+                        badMessages.emplace(msg.msgId);
                     }
                 }
             }
         }
     }
 
-private:
     // All Verify methods take ownership of the passed byMessageHash map and thus might modify the map. This is to avoid
     // unnecessary copies
 
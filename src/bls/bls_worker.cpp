@@ -5,8 +5,10 @@
 #include <bls/bls_worker.h>
 #include <hash.h>
 #include <serialize.h>
+#include <tinyformat.h>
 
 #include <util/ranges.h>
+#include <util/threadnames.h>
 
 #include <algorithm>
 #include <atomic>
@@ -54,6 +56,115 @@ std::pair<std::function<void(T)>, std::future<T> > BuildFutureDoneCallback2()
 }
 
 
+/////
+
+std::string BLSWorkerLaneToString(BLSWorkerLane lane)
+{
+    switch (lane) {
+    case BLSWorkerLane::SIGN: return "sign";
+    case BLSWorkerLane::AGGREGATE: return "aggregate";
+    case BLSWorkerLane::DKG: return "dkg";
+    } // no default case, so the compiler can warn about missing cases
+    assert(false);
+}
+
+CBLSWorkerPool::~CBLSWorkerPool()
+{
+    Stop();
+}
+
+void CBLSWorkerPool::Start(int nThreads)
+{
+    std::unique_lock<std::mutex> l(cs);
+    assert(threads.empty());
+    fStopping = false;
+    for (int i = 0; i < nThreads; i++) {
+        threads.emplace_back([this, i] { ThreadMain(i); });
+    }
+}
+
+void CBLSWorkerPool::ClearQueue()
+{
+    std::unique_lock<std::mutex> l(cs);
+    for (auto& queue : queues) {
+        queue.clear();
+    }
+}
+
+void CBLSWorkerPool::Stop()
+{
+    std::vector<std::thread> toJoin;
+    {
+        std::unique_lock<std::mutex> l(cs);
+        fStopping = true;
+        toJoin = std::move(threads);
+        threads.clear();
+    }
+    cond.notify_all();
+    for (auto& t : toJoin) {
+        t.join();
+    }
+    // without workers, whatever is left can never run
+    ClearQueue();
+}
+
+size_t CBLSWorkerPool::Size() const
+{
+    std::unique_lock<std::mutex> l(cs);
+    return threads.size();
+}
+
+std::array<CBLSWorkerPool::LaneStats, BLS_WORKER_LANE_COUNT> CBLSWorkerPool::GetStats() const
+{
+    std::unique_lock<std::mutex> l(cs);
+    auto ret = stats;
+    for (size_t i = 0; i < BLS_WORKER_LANE_COUNT; i++) {
+        ret[i].nQueued = queues[i].size();
+    }
+    return ret;
+}
+
+void CBLSWorkerPool::Enqueue(BLSWorkerLane lane, std::function<void(int)>&& func)
+{
+    {
+        std::unique_lock<std::mutex> l(cs);
+        queues[static_cast<size_t>(lane)].push_back(Job{std::move(func), std::chrono::steady_clock::now()});
+    }
+    cond.notify_one();
+}
+
+void CBLSWorkerPool::ThreadMain(int threadId)
+{
+    util::ThreadRename(strprintf("bls-work.%d", threadId));
+
+    while (true) {
+        std::function<void(int)> func;
+        {
+            std::unique_lock<std::mutex> l(cs);
+            // lanes are ordered by priority, so the first non-empty queue holds the most urgent job
+            auto it = queues.end();
+            cond.wait(l, [&] {
+                it = std::find_if(queues.begin(), queues.end(), [](const auto& queue) { return !queue.empty(); });
+                return it != queues.end() || fStopping;
+            });
+            if (it == queues.end()) {
+                // stopping and all queued work is done
+                return;
+            }
+
+            auto& laneStats = stats[std::distance(queues.begin(), it)];
+            const int64_t nWaitUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - it->front().queuedTime).count();
+            laneStats.nJobs++;
+            laneStats.nTotalWaitUs += nWaitUs;
+            laneStats.nMaxWaitUs = std::max(laneStats.nMaxWaitUs, nWaitUs);
+
+            func = std::move(it->front().func);
+            it->pop_front();
+        }
+        func(threadId);
+    }
+}
+
 /////
 
 CBLSWorker::CBLSWorker() = default;
@@ -67,14 +178,13 @@ void CBLSWorker::Start()
 {
     int workerCount = std::thread::hardware_concurrency() / 2;
     workerCount = std::max(std::min(1, workerCount), 4);
-    workerPool.resize(workerCount);
-    //RenameThreadPool(workerPool, "bls-work");
+    workerPool.Start(workerCount);
 }
 
 void CBLSWorker::Stop()
 {
-    workerPool.clear_queue();
-    workerPool.stop(true);
+    workerPool.ClearQueue();
+    workerPool.Stop();
 }
 
 bool CBLSWorker::GenerateContributions(int quorumThreshold, Span<CBLSId> ids, BLSVerificationVectorPtr& vvecRet, std::vector<CBLSSecretKey>& skSharesRet)
@@ -99,7 +209,7 @@ bool CBLSWorker::GenerateContributions(int quorumThreshold, Span<CBLSId> ids, BL
             }
             return true;
         };
-        futures.emplace_back(workerPool.push(f));
+        futures.emplace_back(workerPool.Push(BLSWorkerLane::DKG, f));
     }
 
     for (size_t i = 0; i < ids.size(); i += batchSize) {
@@ -113,7 +223,7 @@ bool CBLSWorker::GenerateContributions(int quorumThreshold, Span<CBLSId> ids, BL
             }
             return true;
         };
-        futures.emplace_back(workerPool.push(f));
+        futures.emplace_back(workerPool.Push(BLSWorkerLane::DKG, f));
     }
     return ranges::all_of(futures, [](auto& f){
         return f.get();
@@ -134,7 +244,8 @@ struct Aggregator : public std::enable_shared_from_this<Aggregator<T>> {
     std::shared_ptr<std::vector<const T*> > inputVec;
 
     bool parallel;
-    ctpl::thread_pool& workerPool;
+    CBLSWorkerPool& workerPool;
+    BLSWorkerLane lane;
 
     std::mutex m;
     // items in the queue are all intermediate aggregation results of finished batches.
@@ -151,11 +262,12 @@ struct Aggregator : public std::enable_shared_from_this<Aggregator<T>> {
     // TP can either be a pointer or a reference
     template <typename TP>
     Aggregator(Span<TP> _inputSpan, bool _parallel,
-               ctpl::thread_pool& _workerPool,
+               CBLSWorkerPool& _workerPool, BLSWorkerLane _lane,
                DoneCallback _doneCallback) :
             inputVec(std::make_shared<std::vector<const T*>>(_inputSpan.size())),
             parallel(_parallel),
             workerPool(_workerPool),
+            lane(_lane),
             doneCallback(std::move(_doneCallback))
     {
         for (size_t i = 0; i < _inputSpan.size(); i++) {
@@ -317,7 +429,7 @@ struct Aggregator : public std::enable_shared_from_this<Aggregator<T>> {
     template <typename Callable>
     void PushWork(Callable&& f)
     {
-        workerPool.push(f);
+        workerPool.Push(lane, std::forward<Callable>(f));
     }
 };
 
@@ -343,7 +455,8 @@ struct VectorAggregator : public std::enable_shared_from_this<VectorAggregator<T
 
     VectorVectorType vecs;
     bool parallel;
-    ctpl::thread_pool& workerPool;
+    CBLSWorkerPool& workerPool;
+    BLSWorkerLane lane;
 
     std::atomic<size_t> doneCount{0};
 
@@ -351,12 +464,13 @@ struct VectorAggregator : public std::enable_shared_from_this<VectorAggregator<T
     size_t vecSize;
 
     VectorAggregator(VectorVectorType _vecs,
-                     bool _parallel, ctpl::thread_pool& _workerPool,
+                     bool _parallel, CBLSWorkerPool& _workerPool, BLSWorkerLane _lane,
                      DoneCallback _doneCallback) :
             doneCallback(std::move(_doneCallback)),
             vecs(_vecs),
             parallel(_parallel),
-            workerPool(_workerPool)
+            workerPool(_workerPool),
+            lane(_lane)
     {
         assert(!vecs.empty());
         vecSize = vecs[0]->size();
@@ -372,7 +486,7 @@ struct VectorAggregator : public std::enable_shared_from_this<VectorAggregator<T
             }
 
             auto self(this->shared_from_this());
-            auto aggregator = std::make_shared<AggregatorType>(Span{tmp}, parallel, workerPool, [self, i](const T& agg) {self->CheckDone(agg, i);});
+            auto aggregator = std::make_shared<AggregatorType>(Span{tmp}, parallel, workerPool, lane, [self, i](const T& agg) {self->CheckDone(agg, i);});
             aggregator->Start();
         }
     }
@@ -414,7 +528,7 @@ struct ContributionVerifier : public std::enable_shared_from_this<ContributionVe
     bool parallel;
     bool aggregated;
 
-    ctpl::thread_pool& workerPool;
+    CBLSWorkerPool& workerPool;
 
     size_t batchCount{1};
     size_t verifyCount;
@@ -425,7 +539,7 @@ struct ContributionVerifier : public std::enable_shared_from_this<ContributionVe
 
     ContributionVerifier(CBLSId _forId, Span<BLSVerificationVectorPtr> _vvecs,
                          Span<CBLSSecretKey> _skShares, size_t _batchSize,
-                         bool _parallel, bool _aggregated, ctpl::thread_pool& _workerPool,
+                         bool _parallel, bool _aggregated, CBLSWorkerPool& _workerPool,
                          std::function<void(const std::vector<bool>&)> _doneCallback) :
         forId(std::move(_forId)),
         vvecs(_vvecs),
@@ -488,8 +602,8 @@ struct ContributionVerifier : public std::enable_shared_from_this<ContributionVe
 
         // aggregate vvecs and skShares of batch in parallel
         auto self(this->shared_from_this());
-        auto vvecAgg = std::make_shared<VectorAggregator<CBLSPublicKey>>(vvecs.subspan(batchState.start, batchState.count), parallel, workerPool, [this, self, batchIdx] (const BLSVerificationVectorPtr& vvec) {HandleAggVvecDone(batchIdx, vvec);});
-        auto skShareAgg = std::make_shared<Aggregator<CBLSSecretKey>>(Span{skShares}.subspan(batchState.start, batchState.count), parallel, workerPool, [this, self, batchIdx] (const CBLSSecretKey& skShare) {HandleAggSkShareDone(batchIdx, skShare);});
+        auto vvecAgg = std::make_shared<VectorAggregator<CBLSPublicKey>>(vvecs.subspan(batchState.start, batchState.count), parallel, workerPool, BLSWorkerLane::DKG, [this, self, batchIdx] (const BLSVerificationVectorPtr& vvec) {HandleAggVvecDone(batchIdx, vvec);});
+        auto skShareAgg = std::make_shared<Aggregator<CBLSSecretKey>>(Span{skShares}.subspan(batchState.start, batchState.count), parallel, workerPool, BLSWorkerLane::DKG, [this, self, batchIdx] (const CBLSSecretKey& skShare) {HandleAggSkShareDone(batchIdx, skShare);});
 
         vvecAgg->Start();
         skShareAgg->Start();
@@ -583,7 +697,7 @@ struct ContributionVerifier : public std::enable_shared_from_this<ContributionVe
     void PushOrDoWork(Callable&& f)
     {
         if (parallel) {
-            workerPool.push(std::forward<Callable>(f));
+            workerPool.Push(BLSWorkerLane::DKG, std::forward<Callable>(f));
         } else {
             f(0);
         }
@@ -602,7 +716,7 @@ void CBLSWorker::AsyncBuildQuorumVerificationVector(Span<BLSVerificationVectorPt
         return;
     }
 
-    auto agg = std::make_shared<VectorAggregator<CBLSPublicKey>>(vvecs, parallel, workerPool, std::move(doneCallback));
+    auto agg = std::make_shared<VectorAggregator<CBLSPublicKey>>(vvecs, parallel, workerPool, BLSWorkerLane::DKG, std::move(doneCallback));
     agg->Start();
 }
 
@@ -619,7 +733,7 @@ BLSVerificationVectorPtr CBLSWorker::BuildQuorumVerificationVector(Span<BLSVerif
 }
 
 template <typename T>
-void AsyncAggregateHelper(ctpl::thread_pool& workerPool, Span<T> vec, bool parallel,
+void AsyncAggregateHelper(CBLSWorkerPool& workerPool, Span<T> vec, bool parallel,
                           std::function<void(const T&)> doneCallback)
 {
     if (vec.empty()) {
@@ -631,7 +745,7 @@ void AsyncAggregateHelper(ctpl::thread_pool& workerPool, Span<T> vec, bool paral
         return;
     }
 
-    auto agg = std::make_shared<Aggregator<T>>(vec, parallel, workerPool, std::move(doneCallback));
+    auto agg = std::make_shared<Aggregator<T>>(vec, parallel, workerPool, BLSWorkerLane::AGGREGATE, std::move(doneCallback));
     agg->Start();
 }
 
@@ -733,7 +847,7 @@ std::future<bool> CBLSWorker::AsyncVerifyContributionShare(const CBLSId& forId,
         CBLSPublicKey pk2 = skContribution.GetPublicKey();
         return pk1 == pk2;
     };
-    return workerPool.push(f);
+    return workerPool.Push(BLSWorkerLane::DKG, f);
 }
 
 bool CBLSWorker::VerifyVerificationVector(Span<CBLSPublicKey> vvec)
@@ -767,7 +881,7 @@ bool CBLSWorker::VerifyVerificationVectors(Span<BLSVerificationVectorPtr> vvecs)
 
 void CBLSWorker::AsyncSign(const CBLSSecretKey& secKey, const uint256& msgHash, const CBLSWorker::SignDoneCallback& doneCallback)
 {
-    workerPool.push([secKey, msgHash, doneCallback](int threadId) {
+    workerPool.Push(BLSWorkerLane::SIGN, [secKey, msgHash, doneCallback](int threadId) {
         doneCallback(secKey.Sign(msgHash, bls::bls_legacy_scheme.load()));
     });
 }
@@ -880,5 +994,5 @@ void CBLSWorker::PushSigVerifyBatch()
     sigVerifyQueue.reserve(SIG_VERIFY_BATCH_SIZE);
 
     sigVerifyBatchesInProgress++;
-    workerPool.push(f, batch);
+    workerPool.Push(BLSWorkerLane::SIGN, [f, batch](int threadId) { f(threadId, batch); });
 }
@@ -9,14 +9,87 @@
 
 #include <ctpl_stl.h>
 
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+// Priority classes of BLS work. Idle workers always take the oldest job of the most urgent non-empty lane, so that
+// latency sensitive signing/verification never waits behind a backlog of bulk DKG work
+enum class BLSWorkerLane : uint8_t {
+    SIGN = 0,  // signing and batched signature verification (sig shares, recovered sigs, ChainLocks)
+    AGGREGATE, // aggregation of keys and signatures
+    DKG,       // DKG contribution generation/verification and quorum verification vector builds
+};
+static constexpr size_t BLS_WORKER_LANE_COUNT{3};
+
+std::string BLSWorkerLaneToString(BLSWorkerLane lane);
+
+// Fixed size thread pool with one FIFO queue per BLSWorkerLane
+class CBLSWorkerPool
+{
+public:
+    struct LaneStats {
+        // number of jobs which were picked up by a worker
+        uint64_t nJobs{0};
+        // number of jobs currently waiting for a worker
+        size_t nQueued{0};
+        // time jobs spent waiting for a worker, in microseconds
+        int64_t nTotalWaitUs{0};
+        int64_t nMaxWaitUs{0};
+    };
+
+private:
+    struct Job {
+        std::function<void(int)> func;
+        std::chrono::steady_clock::time_point queuedTime;
+    };
+
+    mutable std::mutex cs;
+    std::condition_variable cond;
+    std::array<std::deque<Job>, BLS_WORKER_LANE_COUNT> queues;
+    std::array<LaneStats, BLS_WORKER_LANE_COUNT> stats;
+    std::vector<std::thread> threads;
+    bool fStopping{false};
+
+public:
+    CBLSWorkerPool() = default;
+    ~CBLSWorkerPool();
+
+    // Starts the worker threads. Jobs pushed before this are queued and picked up once the workers are running
+    void Start(int nThreads);
+    // Drops all jobs which did not start yet
+    void ClearQueue();
+    // Finishes all queued jobs and joins the worker threads
+    void Stop();
+
+    template <typename F>
+    auto Push(BLSWorkerLane lane, F&& f) -> std::future<decltype(f(0))>
+    {
+        using R = decltype(f(0));
+        auto task = std::make_shared<std::packaged_task<R(int)>>(std::forward<F>(f));
+        auto ret = task->get_future();
+        Enqueue(lane, [task](int threadId) { (*task)(threadId); });
+        return ret;
+    }
+
+    size_t Size() const;
+    std::array<LaneStats, BLS_WORKER_LANE_COUNT> GetStats() const;
+
+private:
+    void Enqueue(BLSWorkerLane lane, std::function<void(int)>&& func);
+    void ThreadMain(int threadId);
+};
+
 // Low level BLS/DKG stuff. All very compute intensive and optimized for parallelization
 // The worker tries to parallelize as much as possible and utilizes a few properties of BLS aggregation to speed up things
 // For example, public key vectors can be aggregated in parallel if they are split into batches and the batched aggregations are
@@ -29,7 +102,7 @@ public:
     using CancelCond = std::function<bool()>;
 
 private:
-    ctpl::thread_pool workerPool;
+    CBLSWorkerPool workerPool;
 
     static const int SIG_VERIFY_BATCH_SIZE = 8;
     struct SigVerifyJob {
@@ -125,6 +198,9 @@ public:
     std::future<bool> AsyncVerifySig(const CBLSSignature& sig, const CBLSPublicKey& pubKey, const uint256& msgHash, CancelCond cancelCond = [] { return false; });
     bool IsAsyncVerifyInProgress();
 
+    size_t GetWorkerCount() const { return workerPool.Size(); }
+    std::array<CBLSWorkerPool::LaneStats, BLS_WORKER_LANE_COUNT> GetLaneStats() const { return workerPool.GetStats(); }
+
 private:
     void PushSigVerifyBatch();
 };
@@ -165,6 +241,14 @@ public:
             return CBLSWorker::BuildPubKeyShare(vvec, id);
         });
     }
+    // seed the cache with a public key share which was recovered earlier, e.g. by a previous run
+    void SetPubKeyShare(const uint256& cacheKey, const CBLSPublicKey& pubKeyShare)
+    {
+        std::promise<CBLSPublicKey> p;
+        p.set_value(pubKeyShare);
+        std::lock_guard<std::mutex> lock(cacheCs);
+        publicKeyShareCache.emplace(cacheKey, p.get_future());
+    }
 
 private:
     template <typename T, typename Builder>
@@ -33,11 +33,13 @@ void Transform(uint32_t* s, const unsigned char* chunk, size_t blocks);
 namespace sha256d64_sse41
 {
 void Transform_4way(unsigned char* out, const unsigned char* in);
+void Transform64_4way(unsigned char* out, const unsigned char* in);
 }
 
 namespace sha256d64_avx2
 {
 void Transform_8way(unsigned char* out, const unsigned char* in);
+void Transform64_8way(unsigned char* out, const unsigned char* in);
 }
 
 namespace sha256d64_x86_shani
@@ -477,11 +479,38 @@ void TransformD64Wrapper(unsigned char* out, const unsigned char* in)
     WriteBE32(out + 28, s[7]);
 }
 
+/** Single SHA256 of a 64-byte blob: the input block followed by the constant padding block. */
+template<TransformType tr>
+void Transform64Wrapper(unsigned char* out, const unsigned char* in)
+{
+    uint32_t s[8];
+    static const unsigned char padding[64] = {
+        0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0
+    };
+    sha256::Initialize(s);
+    tr(s, in, 1);
+    tr(s, padding, 1);
+    WriteBE32(out + 0, s[0]);
+    WriteBE32(out + 4, s[1]);
+    WriteBE32(out + 8, s[2]);
+    WriteBE32(out + 12, s[3]);
+    WriteBE32(out + 16, s[4]);
+    WriteBE32(out + 20, s[5]);
+    WriteBE32(out + 24, s[6]);
+    WriteBE32(out + 28, s[7]);
+}
+
 TransformType Transform = sha256::Transform;
 TransformD64Type TransformD64 = sha256::TransformD64;
 TransformD64Type TransformD64_2way = nullptr;
 TransformD64Type TransformD64_4way = nullptr;
 TransformD64Type TransformD64_8way = nullptr;
+TransformD64Type Transform64 = Transform64Wrapper<sha256::Transform>;
+TransformD64Type Transform64_4way = nullptr;
+TransformD64Type Transform64_8way = nullptr;
 
 bool SelfTest() {
     // Input state (equal to the initial SHA256 state)
@@ -565,6 +594,26 @@ bool SelfTest() {
         if (!std::equal(out, out + 256, result_d64)) return false;
     }
 
+    // Test Transform64 and its multi-way variants against the generic implementation.
+    unsigned char result_64[256];
+    for (size_t i = 0; i < 8; ++i) {
+        Transform64Wrapper<sha256::Transform>(result_64 + 32 * i, data + 1 + 64 * i);
+    }
+    Transform64(out, data + 1);
+    if (!std::equal(out, out + 32, result_64)) return false;
+
+    if (Transform64_4way) {
+        unsigned char out[128];
+        Transform64_4way(out, data + 1);
+        if (!std::equal(out, out + 128, result_64)) return false;
+    }
+
+    if (Transform64_8way) {
+        unsigned char out[256];
+        Transform64_8way(out, data + 1);
+        if (!std::equal(out, out + 256, result_64)) return false;
+    }
+
     return true;
 }
 
@@ -588,6 +637,9 @@ std::string SHA256AutoDetect(sha256_implementation::UseImplementation use_implem
     TransformD64_2way = nullptr;
     TransformD64_4way = nullptr;
     TransformD64_8way = nullptr;
+    Transform64 = Transform64Wrapper<sha256::Transform>;
+    Transform64_4way = nullptr;
+    Transform64_8way = nullptr;
 
 #if defined(USE_ASM) && defined(HAVE_GETCPUID)
     bool have_sse4 = false;
@@ -622,6 +674,7 @@ std::string SHA256AutoDetect(sha256_implementation::UseImplementation use_implem
         Transform = sha256_x86_shani::Transform;
         TransformD64 = TransformD64Wrapper<sha256_x86_shani::Transform>;
         TransformD64_2way = sha256d64_x86_shani::Transform_2way;
+        Transform64 = Transform64Wrapper<sha256_x86_shani::Transform>;
         ret = "x86_shani(1way,2way)";
         have_sse4 = false; // Disable SSE4/AVX2;
         have_avx2 = false;
@@ -632,10 +685,12 @@ std::string SHA256AutoDetect(sha256_implementation::UseImplementation use_implem
 #if defined(__x86_64__) || defined(__amd64__)
         Transform = sha256_sse4::Transform;
         TransformD64 = TransformD64Wrapper<sha256_sse4::Transform>;
+        Transform64 = Transform64Wrapper<sha256_sse4::Transform>;
         ret = "sse4(1way)";
 #endif
 #if defined(ENABLE_SSE41) && !defined(BUILD_SYSCOIN_INTERNAL)
         TransformD64_4way = sha256d64_sse41::Transform_4way;
+        Transform64_4way = sha256d64_sse41::Transform64_4way;
         ret += ",sse41(4way)";
 #endif
     }
@@ -643,6 +698,7 @@ std::string SHA256AutoDetect(sha256_implementation::UseImplementation use_implem
 #if defined(ENABLE_AVX2) && !defined(BUILD_SYSCOIN_INTERNAL)
     if (have_avx2 && have_avx && enabled_avx) {
         TransformD64_8way = sha256d64_avx2::Transform_8way;
+        Transform64_8way = sha256d64_avx2::Transform64_8way;
         ret += ",avx2(8way)";
     }
 #endif
@@ -677,6 +733,7 @@ std::string SHA256AutoDetect(sha256_implementation::UseImplementation use_implem
         Transform = sha256_arm_shani::Transform;
         TransformD64 = TransformD64Wrapper<sha256_arm_shani::Transform>;
         TransformD64_2way = sha256d64_arm_shani::Transform_2way;
+        Transform64 = Transform64Wrapper<sha256_arm_shani::Transform>;
         ret = "arm_shani(1way,2way)";
     }
 #endif
@@ -775,3 +832,29 @@ void SHA256D64(unsigned char* out, const unsigned char* in, size_t blocks)
         --blocks;
     }
 }
+
+void SHA256_64(unsigned char* out, const unsigned char* in, size_t blocks)
+{
+    if (Transform64_8way) {
+        while (blocks >= 8) {
+            Transform64_8way(out, in);
+            out += 256;
+            in += 512;
+            blocks -= 8;
+        }
+    }
+    if (Transform64_4way) {
+        while (blocks >= 4) {
+            Transform64_4way(out, in);
+            out += 128;
+            in += 256;
+            blocks -= 4;
+        }
+    }
+    while (blocks) {
+        Transform64(out, in);
+        out += 32;
+        in += 64;
+        --blocks;
+    }
+}
@@ -71,9 +71,9 @@ void inline Write8(unsigned char* out, int offset, __m256i v) {
     WriteLE32(out + 224 + offset, _mm256_extract_epi32(v, 0));
 }
 
-}
-
-void Transform_8way(unsigned char* out, const unsigned char* in)
+/** 8-way SHA256 of 64-byte blobs; fDouble selects SHA256D64 (hash of the hash) over a single SHA256. */
+template <bool fDouble>
+void Transform(unsigned char* out, const unsigned char* in)
 {
     // Transform 1
     __m256i a = K(0x6a09e667ul);
@@ -238,6 +238,18 @@ void Transform_8way(unsigned char* out, const unsigned char* in)
     w6 = Add(t6, g);
     w7 = Add(t7, h);
 
+    if constexpr (!fDouble) {
+        Write8(out, 0, w0);
+        Write8(out, 4, w1);
+        Write8(out, 8, w2);
+        Write8(out, 12, w3);
+        Write8(out, 16, w4);
+        Write8(out, 20, w5);
+        Write8(out, 24, w6);
+        Write8(out, 28, w7);
+        return;
+    }
+
     // Transform 3
     a = K(0x6a09e667ul);
     b = K(0xbb67ae85ul);
@@ -324,6 +336,18 @@ void Transform_8way(unsigned char* out, const unsigned char* in)
     Write8(out, 28, Add(h, K(0x5be0cd19ul)));
 }
 
+} // namespace
+
+void Transform_8way(unsigned char* out, const unsigned char* in)
+{
+    Transform<true>(out, in);
+}
+
+void Transform64_8way(unsigned char* out, const unsigned char* in)
+{
+    Transform<false>(out, in);
+}
+
 }
 
 #endif
@@ -63,9 +63,9 @@ void inline Write4(unsigned char* out, int offset, __m128i v) {
     WriteLE32(out + 96 + offset, _mm_extract_epi32(v, 0));
 }
 
-}
-
-void Transform_4way(unsigned char* out, const unsigned char* in)
+/** 4-way SHA256 of 64-byte blobs; fDouble selects SHA256D64 (hash of the hash) over a single SHA256. */
+template <bool fDouble>
+void Transform(unsigned char* out, const unsigned char* in)
 {
     // Transform 1
     __m128i a = K(0x6a09e667ul);
@@ -230,6 +230,18 @@ void Transform_4way(unsigned char* out, const unsigned char* in)
     w6 = Add(t6, g);
     w7 = Add(t7, h);
 
+    if constexpr (!fDouble) {
+        Write4(out, 0, w0);
+        Write4(out, 4, w1);
+        Write4(out, 8, w2);
+        Write4(out, 12, w3);
+        Write4(out, 16, w4);
+        Write4(out, 20, w5);
+        Write4(out, 24, w6);
+        Write4(out, 28, w7);
+        return;
+    }
+
     // Transform 3
     a = K(0x6a09e667ul);
     b = K(0xbb67ae85ul);
@@ -316,6 +328,18 @@ void Transform_4way(unsigned char* out, const unsigned char* in)
     Write4(out, 28, Add(h, K(0x5be0cd19ul)));
 }
 
+} // namespace
+
+void Transform_4way(unsigned char* out, const unsigned char* in)
+{
+    Transform<true>(out, in);
+}
+
+void Transform64_4way(unsigned char* out, const unsigned char* in)
+{
+    Transform<false>(out, in);
+}
+
 }
 
 #endif
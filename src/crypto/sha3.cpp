@@ -5,15 +5,29 @@
 // Based on https://github.com/mjosaarinen/tiny_sha3/blob/master/sha3.c
 // by Markku-Juhani O. Saarinen <mjos@iki.fi>
 
+#if defined(HAVE_CONFIG_H)
+#include <config/syscoin-config.h>
+#endif
+
 #include <crypto/sha3.h>
+#include <compat/cpuid.h>
 #include <crypto/common.h>
 #include <span.h>
 
 #include <algorithm>
 #include <array> // For std::begin and std::end.
+#include <cassert>
 
 #include <stdint.h>
 
+// SYSCOIN
+#if defined(__x86_64__) || defined(__amd64__) || defined(__i386__)
+namespace keccak_avx2
+{
+void KeccakF_4way(uint64_t (&st)[25][4]);
+}
+#endif
+
 // Internal implementation code.
 namespace
 {
@@ -159,3 +173,160 @@ SHA3_256& SHA3_256::Reset()
     std::fill(std::begin(m_state), std::end(m_state), 0);
     return *this;
 }
+
+// SYSCOIN
+namespace
+{
+//! Keccak-256 sponge rate in bytes.
+constexpr size_t KECCAK256_RATE = 136;
+
+typedef void (*KeccakF4wayType)(uint64_t (&)[25][4]);
+KeccakF4wayType KeccakF_4way = nullptr;
+
+void Keccak256AbsorbBlock(uint64_t (&st)[25], const unsigned char* block)
+{
+    for (size_t i = 0; i < KECCAK256_RATE / 8; ++i) {
+        st[i] ^= ReadLE64(block + 8 * i);
+    }
+}
+
+/** Build the padded final block of a Keccak-256 input. */
+void Keccak256PadBlock(Span<const unsigned char> input, unsigned char (&block)[KECCAK256_RATE])
+{
+    const size_t tail = input.size() % KECCAK256_RATE;
+    std::fill(std::begin(block), std::end(block), 0);
+    std::copy(input.end() - tail, input.end(), block);
+    block[tail] ^= 0x01;
+    block[KECCAK256_RATE - 1] ^= 0x80;
+}
+
+/** Absorb blocks [first, end) of input, including the padded final block, and squeeze 32 bytes. */
+void Keccak256Finish(uint64_t (&st)[25], Span<const unsigned char> input, size_t first, unsigned char* output)
+{
+    const size_t full = input.size() / KECCAK256_RATE;
+    for (size_t block = first; block < full; ++block) {
+        Keccak256AbsorbBlock(st, input.data() + block * KECCAK256_RATE);
+        KeccakF(st);
+    }
+    unsigned char pad[KECCAK256_RATE];
+    Keccak256PadBlock(input, pad);
+    Keccak256AbsorbBlock(st, pad);
+    KeccakF(st);
+    for (unsigned i = 0; i < 4; ++i) {
+        WriteLE64(output + 8 * i, st[i]);
+    }
+}
+
+/** Hash four inputs at once for as many blocks as they have in common, then finish each lane on its own. */
+void Keccak256_4way(const Span<const unsigned char>* inputs, unsigned char* output)
+{
+    uint64_t st4[25][4] = {};
+    unsigned char pad[4][KECCAK256_RATE];
+    size_t blocks = SIZE_MAX;
+    for (int lane = 0; lane < 4; ++lane) {
+        Keccak256PadBlock(inputs[lane], pad[lane]);
+        blocks = std::min(blocks, inputs[lane].size() / KECCAK256_RATE + 1);
+    }
+    for (size_t block = 0; block < blocks; ++block) {
+        for (int lane = 0; lane < 4; ++lane) {
+            const unsigned char* data = (block + 1) * KECCAK256_RATE <= inputs[lane].size() ? inputs[lane].data() + block * KECCAK256_RATE : pad[lane];
+            for (size_t i = 0; i < KECCAK256_RATE / 8; ++i) {
+                st4[i][lane] ^= ReadLE64(data + 8 * i);
+            }
+        }
+        KeccakF_4way(st4);
+    }
+    for (int lane = 0; lane < 4; ++lane) {
+        uint64_t st[25];
+        for (int i = 0; i < 25; ++i) {
+            st[i] = st4[i][lane];
+        }
+        if (blocks == inputs[lane].size() / KECCAK256_RATE + 1) {
+            // the padded block went through the shared permutation already
+            for (unsigned i = 0; i < 4; ++i) {
+                WriteLE64(output + 32 * lane + 8 * i, st[i]);
+            }
+        } else {
+            Keccak256Finish(st, inputs[lane], blocks, output + 32 * lane);
+        }
+    }
+}
+
+#if defined(USE_ASM) && defined(HAVE_GETCPUID) && defined(ENABLE_AVX2) && !defined(BUILD_SYSCOIN_INTERNAL)
+bool KeccakSelfTest()
+{
+    uint64_t st4[25][4];
+    uint64_t st[4][25];
+    for (int i = 0; i < 25; ++i) {
+        for (int lane = 0; lane < 4; ++lane) {
+            st[lane][i] = st4[i][lane] = 0x0123456789abcdefULL * (i + 1) + lane;
+        }
+    }
+    KeccakF_4way(st4);
+    for (int lane = 0; lane < 4; ++lane) {
+        KeccakF(st[lane]);
+        for (int i = 0; i < 25; ++i) {
+            if (st[lane][i] != st4[i][lane]) return false;
+        }
+    }
+    return true;
+}
+
+/** Check whether the OS has enabled AVX registers. */
+bool AVXEnabled()
+{
+    uint32_t a, d;
+    __asm__("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+    return (a & 6) == 6;
+}
+#endif
+} // namespace
+
+void Keccak256(Span<const unsigned char> input, Span<unsigned char> output)
+{
+    assert(output.size() == SHA3_256::OUTPUT_SIZE);
+    uint64_t st[25] = {0};
+    Keccak256Finish(st, input, 0, output.data());
+}
+
+void Keccak256Many(Span<const Span<const unsigned char>> inputs, Span<unsigned char> output)
+{
+    assert(output.size() == inputs.size() * SHA3_256::OUTPUT_SIZE);
+    size_t i = 0;
+    if (KeccakF_4way) {
+        for (; i + 4 <= inputs.size(); i += 4) {
+            Keccak256_4way(inputs.data() + i, output.data() + i * SHA3_256::OUTPUT_SIZE);
+        }
+    }
+    for (; i < inputs.size(); ++i) {
+        Keccak256(inputs[i], output.subspan(i * SHA3_256::OUTPUT_SIZE, SHA3_256::OUTPUT_SIZE));
+    }
+}
+
+size_t KeccakLanes()
+{
+    return KeccakF_4way ? 4 : 1;
+}
+
+std::string KeccakAutoDetect()
+{
+    std::string ret = "standard";
+    KeccakF_4way = nullptr;
+
+#if defined(USE_ASM) && defined(HAVE_GETCPUID) && defined(ENABLE_AVX2) && !defined(BUILD_SYSCOIN_INTERNAL)
+    uint32_t eax, ebx, ecx, edx;
+    GetCPUID(1, 0, eax, ebx, ecx, edx);
+    const bool have_xsave = (ecx >> 27) & 1;
+    const bool have_avx = (ecx >> 28) & 1;
+    if (have_xsave && have_avx && AVXEnabled()) {
+        GetCPUID(7, 0, eax, ebx, ecx, edx);
+        if ((ebx >> 5) & 1) {
+            KeccakF_4way = keccak_avx2::KeccakF_4way;
+            ret = "avx2(4way)";
+            assert(KeccakSelfTest());
+        }
+    }
+#endif
+
+    return ret;
+}
@@ -9,10 +9,25 @@
 
 #include <cstdlib>
 #include <stdint.h>
+#include <string>
 
 //! The Keccak-f[1600] transform.
 void KeccakF(uint64_t (&st)[25]);
 
+// SYSCOIN
+/** Keccak-256 with the original Keccak padding, as used by Ethereum and for PoDA version hashes. */
+void Keccak256(Span<const unsigned char> input, Span<unsigned char> output);
+/**
+ * Keccak-256 of several independent inputs, output receives 32 bytes per input.
+ * Groups of inputs are hashed in lockstep by a multi-lane Keccak-f[1600] kernel when one is
+ * available, so callers should pass inputs of similar length next to each other.
+ */
+void Keccak256Many(Span<const Span<const unsigned char>> inputs, Span<unsigned char> output);
+/** Autodetect the best available multi-lane Keccak-f[1600] implementation. Returns its name. */
+std::string KeccakAutoDetect();
+/** Number of inputs Keccak256Many hashes in lockstep with the detected kernel, 1 if there is none. */
+size_t KeccakLanes();
+
 class SHA3_256
 {
 private:
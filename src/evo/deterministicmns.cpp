@@ -22,6 +22,8 @@
 #include <interfaces/chain.h>
 #include <util/fs.h>
 #include <util/fs_helpers.h>
+#include <crypto/sha256.h>
+#include <hash.h>
 
 #include <algorithm>
 #include <chrono>
@@ -57,8 +59,9 @@ void CollectRetainedSnapshotHashes(
     }
 }
 
+template <typename V>
 bool CollectPersistedKeysOutsideWindow(
-    CEvoDB<uint256, CDeterministicMNList, StaticSaltedHasher>& evo_db,
+    CEvoDB<uint256, V, StaticSaltedHasher>& evo_db,
     const EvoEraseSet& retained_hashes,
     std::vector<uint256>& prune_keys,
     size_t& persisted_snapshot_count)
@@ -105,9 +108,14 @@ bool WarmReadCacheFromWindow(
 }
 } // namespace
 
-CDeterministicMNManager::CDeterministicMNManager(const DBParams& db_params)
+CDeterministicMNManager::CDeterministicMNManager(const DBParams& db_params, bool diff_storage) :
+    m_diff_storage(diff_storage)
 {
     m_evoDb = std::make_unique<CEvoDB<uint256, CDeterministicMNList, StaticSaltedHasher>>(db_params, LIST_CACHE_SIZE);
+    DBParams diff_db_params{db_params};
+    diff_db_params.path += "_diffs";
+    // the diffs back to the snapshot below the oldest retained list are kept as well
+    m_evoDbDiffs = std::make_unique<CEvoDB<uint256, CDeterministicMNListDiff, StaticSaltedHasher>>(diff_db_params, LIST_CACHE_SIZE + DISK_SNAPSHOT_PERIOD);
     if (m_evoDb->CountPersistedEntries() > 0) {
         m_persistent_window_initialized.store(true, std::memory_order_relaxed);
         m_evoDb->SetReadCacheSize(HOT_LIST_CACHE_SIZE);
@@ -248,35 +256,41 @@ static int CompareByLastPaid_GetHeight(const CDeterministicMN& dmn)
     return height;
 }
 
-static bool CompareByLastPaid(const CDeterministicMN& _a, const CDeterministicMN& _b)
+// Payment order is by last paid height, ties broken by proTxHash
+CDeterministicMNList::MnPayeeKey CDeterministicMNList::GetPayeeKey(const CDeterministicMN& dmn)
 {
-    int ah = CompareByLastPaid_GetHeight(_a);
-    int bh = CompareByLastPaid_GetHeight(_b);
-    if (ah == bh) {
-        return _a.proTxHash < _b.proTxHash;
-    } else {
-        return ah < bh;
+    return {CompareByLastPaid_GetHeight(dmn), dmn.proTxHash};
+}
+
+void CDeterministicMNList::AddToPayeeIndex(const CDeterministicMN& dmn)
+{
+    if (!IsMNValid(dmn)) {
+        return;
     }
+    const MnPayeeKey key = GetPayeeKey(dmn);
+    const auto it = std::lower_bound(mnPayeeIndex.begin(), mnPayeeIndex.end(), key);
+    mnPayeeIndex = mnPayeeIndex.insert(it - mnPayeeIndex.begin(), key);
 }
-static bool CompareByLastPaid(const CDeterministicMN* _a, const CDeterministicMN* _b)
+
+void CDeterministicMNList::RemoveFromPayeeIndex(const CDeterministicMN& dmn)
 {
-    return CompareByLastPaid(*_a, *_b);
+    if (!IsMNValid(dmn)) {
+        return;
+    }
+    const MnPayeeKey key = GetPayeeKey(dmn);
+    const auto it = std::lower_bound(mnPayeeIndex.begin(), mnPayeeIndex.end(), key);
+    if (it == mnPayeeIndex.end() || *it != key) {
+        throw(std::runtime_error(strprintf("%s: Can't find a masternode %s in the payee index", __func__, dmn.proTxHash.ToString())));
+    }
+    mnPayeeIndex = mnPayeeIndex.erase(it - mnPayeeIndex.begin());
 }
 
 CDeterministicMNCPtr CDeterministicMNList::GetMNPayee() const
 {
-    if (mnMap.size() == 0) {
+    if (mnPayeeIndex.empty()) {
         return nullptr;
     }
-
-    CDeterministicMNCPtr best;
-    ForEachMNShared(true, [&](const CDeterministicMNCPtr& dmn) {
-        if (!best || CompareByLastPaid(dmn.get(), best.get())) {
-            best = dmn;
-        }
-    });
-
-    return best;
+    return GetMN(mnPayeeIndex.front().second);
 }
 
 std::vector<CDeterministicMNCPtr> CDeterministicMNList::GetProjectedMNPayees(int nCount) const
@@ -284,42 +298,41 @@ std::vector<CDeterministicMNCPtr> CDeterministicMNList::GetProjectedMNPayees(int
     if (nCount < 0 ) {
         return {};
     }
-    const size_t validCount = GetValidMNsCount();
+    const size_t validCount = mnPayeeIndex.size();
     if ((size_t)nCount > validCount) {
         nCount = validCount;
     }
 
     std::vector<CDeterministicMNCPtr> result;
     result.reserve(nCount);
-
-    ForEachMNShared(true, [&](const CDeterministicMNCPtr& dmn) {
-        result.emplace_back(dmn);
-    });
-    std::sort(result.begin(), result.end(), [&](const CDeterministicMNCPtr& a, const CDeterministicMNCPtr& b) {
-        return CompareByLastPaid(a.get(), b.get());
-    });
-
-    result.resize(nCount);
+    for (auto it = mnPayeeIndex.begin(); result.size() < (size_t)nCount; ++it) {
+        result.emplace_back(GetMN(it->second));
+    }
 
     return result;
 }
 
 std::vector<CDeterministicMNCPtr> CDeterministicMNList::CalculateQuorum(size_t maxSize, const uint256& modifier) const
 {
-    auto scores = CalculateScores(modifier);
+    return SelectQuorum(CalculateScores(modifier), maxSize);
+}
 
-    // sort is descending order
-    std::sort(scores.rbegin(), scores.rend(), [](const std::pair<arith_uint256, CDeterministicMNCPtr>& a, const std::pair<arith_uint256, CDeterministicMNCPtr>& b) {
+std::vector<CDeterministicMNCPtr> CDeterministicMNList::SelectQuorum(std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>> scores, size_t maxSize)
+{
+    const size_t nResult = std::min(maxSize, scores.size());
+
+    // only the top maxSize entries are needed, in descending order
+    std::partial_sort(scores.begin(), scores.begin() + nResult, scores.end(), [](const std::pair<arith_uint256, CDeterministicMNCPtr>& a, const std::pair<arith_uint256, CDeterministicMNCPtr>& b) {
         if (a.first == b.first) {
             // this should actually never happen, but we should stay compatible with how the non-deterministic MNs did the sorting
-            return a.second->collateralOutpoint < b.second->collateralOutpoint;
+            return b.second->collateralOutpoint < a.second->collateralOutpoint;
         }
-        return a.first < b.first;
+        return b.first < a.first;
     });
 
     // take top maxSize entries and return it
     std::vector<CDeterministicMNCPtr> result;
-    result.resize(std::min(maxSize, scores.size()));
+    result.resize(nResult);
     for (size_t i = 0; i < result.size(); i++) {
         result[i] = std::move(scores[i].second);
     }
@@ -333,6 +346,14 @@ std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>> CDeterministicMNList
     int nLegacyNodeCount = 0;
     std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>> scores;
     scores.reserve(GetAllMNsCount());
+    // calculate sha256(sha256(proTxHash, confirmedHash), modifier) per MN
+    // Please note that this is not a double-sha256 but a single-sha256
+    // The first part is already precalculated (confirmedHashWithProRegTxHash), so every message is exactly
+    // 64 bytes and all of them are hashed in one batch with the multi-way SHA256 implementations
+    std::vector<unsigned char> vMessages;
+    vMessages.reserve(GetAllMNsCount() * 64);
+    std::vector<size_t> vHashed;
+    vHashed.reserve(GetAllMNsCount());
     ForEachMNShared(true, [&](const CDeterministicMNCPtr& dmn) {
         if (dmn->pdmnState->confirmedHash.IsNull()) {
             // we only take confirmed MNs into account to avoid hash grinding on the ProRegTxHash to sneak MNs into a
@@ -350,19 +371,18 @@ std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>> CDeterministicMNList
                 return; // Skip normal calculation
             }
          }
-        // calculate sha256(sha256(proTxHash, confirmedHash), modifier) per MN
-        // Please note that this is not a double-sha256 but a single-sha256
-        // The first part is already precalculated (confirmedHashWithProRegTxHash)
-        // TODO When https://github.com/bitcoin/bitcoin/pull/13191 gets backported, implement something that is similar but for single-sha256
-        uint256 h;
-        CSHA256 sha256;
-        sha256.Write(dmn->pdmnState->confirmedHashWithProRegTxHash.begin(), dmn->pdmnState->confirmedHashWithProRegTxHash.size());
-        sha256.Write(modifier.begin(), modifier.size());
-        sha256.Finalize(h.begin());
-
-        scores.emplace_back(UintToArith256(h), dmn);
+        vHashed.emplace_back(scores.size());
+        vMessages.insert(vMessages.end(), dmn->pdmnState->confirmedHashWithProRegTxHash.begin(), dmn->pdmnState->confirmedHashWithProRegTxHash.end());
+        vMessages.insert(vMessages.end(), modifier.begin(), modifier.end());
+        scores.emplace_back(arith_uint256(), dmn);
     });
 
+    std::vector<unsigned char> vHashes(vHashed.size() * 32);
+    SHA256_64(vHashes.data(), vMessages.data(), vHashed.size());
+    for (size_t i = 0; i < vHashed.size(); i++) {
+        scores[vHashed[i]].first = UintToArith256(uint256(Span{vHashes.data() + i * 32, 32}));
+    }
+
     return scores;
 }
 
@@ -591,6 +611,7 @@ void CDeterministicMNList::AddMN(const CDeterministicMNCPtr& dmn, bool fBumpTota
     }
     mnMap = mnMap.set(dmn->proTxHash, dmn);
     mnInternalIdMap = mnInternalIdMap.set(dmn->GetInternalId(), dmn->proTxHash);
+    AddToPayeeIndex(*dmn);
     if (fBumpTotalCount) {
         // nTotalRegisteredCount acts more like a checkpoint, not as a limit,
         nTotalRegisteredCount = std::max(dmn->GetInternalId() + 1, (uint64_t)nTotalRegisteredCount);
@@ -628,6 +649,10 @@ void CDeterministicMNList::UpdateMN(const CDeterministicMN& oldDmn, const std::s
                 oldDmn.proTxHash.ToString(), HexStr(oldState->vchNEVMAddress), HexStr(pdmnState->vchNEVMAddress))));
     }
     mnMap = mnMap.set(oldDmn.proTxHash, dmn);
+    if (GetPayeeKey(oldDmn) != GetPayeeKey(*dmn) || IsMNValid(oldDmn) != IsMNValid(*dmn)) {
+        RemoveFromPayeeIndex(oldDmn);
+        AddToPayeeIndex(*dmn);
+    }
 }
 
 void CDeterministicMNList::UpdateMN(const uint256& proTxHash, const std::shared_ptr<const CDeterministicMNState>& pdmnState)
@@ -685,6 +710,7 @@ void CDeterministicMNList::RemoveMN(const uint256& proTxHash)
     }
     mnMap = mnMap.erase(proTxHash);
     mnInternalIdMap = mnInternalIdMap.erase(dmn->GetInternalId());
+    RemoveFromPayeeIndex(*dmn);
 }
 
 std::string CDeterministicMNListNEVMAddressDiff::ToString() const {
@@ -739,7 +765,8 @@ bool CDeterministicMNManager::ProcessBlock(const CBlock& block, const CBlockInde
 
         newList.SetBlockHash(pindex->GetBlockHash());
 
-        if(!ibd || (fNEVMConnection && fNexusActive && newList.m_changed_nevm_address)) {
+        const bool fBuildDiff{!ibd || (fNEVMConnection && fNexusActive && newList.m_changed_nevm_address)};
+        if(fBuildDiff) {
             oldList.BuildDiff(newList, diff, diffNEVM);
         }
         if(!ibd) {
@@ -749,7 +776,19 @@ bool CDeterministicMNManager::ProcessBlock(const CBlock& block, const CBlockInde
             // always update interface for payment detail changes
             uiInterface.NotifyMasternodeListChanged(newList);
         }
-        m_evoDb->WriteCache(pindex->GetBlockHash(), std::move(newList));
+        if (m_diff_storage) {
+            AddHotList(newList);
+        }
+        // a diff needs the previous list to be stored, the first list after DIP3 or a wipe is always written in full
+        if (m_diff_storage && nHeight % DISK_SNAPSHOT_PERIOD != 0 && HasStoredList(pindex->pprev)) {
+            if (!fBuildDiff) {
+                CDeterministicMNListNEVMAddressDiff diffNEVMUnused;
+                oldList.BuildDiff(newList, diff, diffNEVMUnused);
+            }
+            m_evoDbDiffs->WriteCache(pindex->GetBlockHash(), std::move(diff));
+        } else {
+            m_evoDb->WriteCache(pindex->GetBlockHash(), std::move(newList));
+        }
        
     } catch (const std::exception& e) {
         LogPrint(BCLog::MNLIST, "CDeterministicMNManager::%s -- internal error: %s\n", __func__, e.what());
@@ -762,11 +801,9 @@ bool CDeterministicMNManager::ProcessBlock(const CBlock& block, const CBlockInde
 
 bool CDeterministicMNManager::UndoBlock(const CBlockIndex* pindex, CDeterministicMNListNEVMAddressDiff &inversedDiffNEVMAddress)
 {
-    uint256 blockHash = pindex->GetBlockHash();
-
     CDeterministicMNList curList;
     CDeterministicMNList prevList;
-    bool readCache = m_evoDb->ReadCache(blockHash, curList);
+    bool readCache = ReadListForBlock(pindex, curList);
     if(readCache) {
         prevList = GetListForBlockInternal(pindex->pprev);
         CDeterministicMNListDiff inversedDiff;
@@ -1077,6 +1114,85 @@ void CDeterministicMNManager::DecreasePoSePenalties(CDeterministicMNList& mnList
     }
 }
 
+void CDeterministicMNManager::AddHotList(const CDeterministicMNList& list)
+{
+    LOCK(cs);
+    auto [it, inserted] = mapHotLists.try_emplace(list.GetBlockHash(), list);
+    if (!inserted) {
+        return;
+    }
+    listHotOrder.push_front(list.GetBlockHash());
+    while (listHotOrder.size() > HOT_LIST_CACHE_SIZE) {
+        mapHotLists.erase(listHotOrder.back());
+        listHotOrder.pop_back();
+    }
+}
+
+bool CDeterministicMNManager::ReadHotList(const uint256& blockHash, CDeterministicMNList& list)
+{
+    LOCK(cs);
+    auto it = mapHotLists.find(blockHash);
+    if (it == mapHotLists.end()) {
+        return false;
+    }
+    list = it->second;
+    return true;
+}
+
+bool CDeterministicMNManager::HasStoredList(const CBlockIndex* pindex)
+{
+    if (pindex == nullptr) {
+        return false;
+    }
+    const uint256& blockHash = pindex->GetBlockHash();
+    if (WITH_LOCK(cs, return mapHotLists.count(blockHash) > 0)) {
+        return true;
+    }
+    return m_evoDb->ExistsCache(blockHash) || m_evoDbDiffs->ExistsCache(blockHash);
+}
+
+bool CDeterministicMNManager::ReadListForBlock(const CBlockIndex* pindex, CDeterministicMNList& list)
+{
+    const uint256& blockHash = pindex->GetBlockHash();
+    if (ReadHotList(blockHash, list) || m_evoDb->ReadCache(blockHash, list)) {
+        return true;
+    }
+
+    // walk back over the stored diffs to the nearest full list and replay them onto it
+    const int nDIP0003Height = Params().GetConsensus().DIP0003Height;
+    std::vector<std::pair<const CBlockIndex*, CDeterministicMNListDiff>> vecDiffs;
+    CDeterministicMNList snapshot;
+    for (const CBlockIndex* pcur = pindex; ; ) {
+        CDeterministicMNListDiff diff;
+        if (!m_evoDbDiffs->ReadCache(pcur->GetBlockHash(), diff)) {
+            return false;
+        }
+        vecDiffs.emplace_back(pcur, std::move(diff));
+        pcur = pcur->pprev;
+        if (pcur == nullptr) {
+            return false;
+        }
+        if (pcur->nHeight < nDIP0003Height) {
+            break;
+        }
+        if (ReadHotList(pcur->GetBlockHash(), snapshot) || m_evoDb->ReadCache(pcur->GetBlockHash(), snapshot)) {
+            break;
+        }
+    }
+    try {
+        for (auto it = vecDiffs.rbegin(); it != vecDiffs.rend(); ++it) {
+            snapshot = snapshot.ApplyDiff(it->first, it->second);
+        }
+    } catch (const std::exception& e) {
+        LogPrintf("CDeterministicMNManager::%s -- failed to apply diffs for block %s: %s\n", __func__, blockHash.ToString(), e.what());
+        return false;
+    }
+    LogPrint(BCLog::MNLIST, "CDeterministicMNManager::%s -- applied %d diffs for block %s\n", __func__, vecDiffs.size(), blockHash.ToString());
+    AddHotList(snapshot);
+    list = std::move(snapshot);
+    return true;
+}
+
 const CDeterministicMNList CDeterministicMNManager::GetListForBlockInternal(const CBlockIndex* pindex)
 {
     CDeterministicMNList snapshot;
@@ -1085,7 +1201,7 @@ const CDeterministicMNList CDeterministicMNManager::GetListForBlockInternal(cons
     if (!fDIP0003Active) {
         return snapshot;
     }
-    if (!m_evoDb->ReadCache(pindex->GetBlockHash(), snapshot)) {
+    if (!ReadListForBlock(pindex, snapshot)) {
         snapshot = CDeterministicMNList(pindex->GetBlockHash(), pindex->nHeight, 0);
         m_evoDb->WriteCache(pindex->GetBlockHash(), snapshot);
         LogPrint(BCLog::MNLIST, "CDeterministicMNManager::%s -- initial snapshot. blockHash=%s nHeight=%d\n", __func__,
@@ -1111,6 +1227,24 @@ const CDeterministicMNList CDeterministicMNManager::GetListAtChainTip()
     return GetListForBlockInternal(pindex);
 }
 
+std::vector<CDeterministicMNCPtr> CDeterministicMNManager::CalculateQuorum(const CBlockIndex* pindex, size_t maxSize, const uint256& modifier)
+{
+    const uint256 cacheKey = (HashWriter{} << pindex->GetBlockHash() << modifier).GetHash();
+    std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>> scores;
+    {
+        LOCK(cs_scores);
+        if (mapScores.get(cacheKey, scores)) {
+            return CDeterministicMNList::SelectQuorum(std::move(scores), maxSize);
+        }
+    }
+    scores = GetListForBlock(pindex).CalculateScores(modifier);
+    {
+        LOCK(cs_scores);
+        mapScores.insert(cacheKey, scores);
+    }
+    return CDeterministicMNList::SelectQuorum(std::move(scores), maxSize);
+}
+
 void CDeterministicMNManager::UpdatedBlockTip(const CBlockIndex* pindex) {
     WITH_LOCK(cs, tipIndex = pindex;);
 }
@@ -1151,8 +1285,8 @@ bool CDeterministicMNManager::DoMaintenance(bool bForceFlush, bool fSync) {
     const auto maintenance_start = std::chrono::steady_clock::now();
     const CBlockIndex* tip = WITH_LOCK(cs, return tipIndex;);
     if (tip == nullptr) {
-        const size_t cache_entry_count{m_evoDb->GetReadWriteCacheSize()};
-        const size_t erase_entry_count{m_evoDb->GetEraseCacheSize()};
+        const size_t cache_entry_count{m_evoDb->GetReadWriteCacheSize() + m_evoDbDiffs->GetReadWriteCacheSize()};
+        const size_t erase_entry_count{m_evoDb->GetEraseCacheSize() + m_evoDbDiffs->GetEraseCacheSize()};
         if (cache_entry_count == 0 && erase_entry_count == 0) {
             return true;
         }
@@ -1162,12 +1296,13 @@ bool CDeterministicMNManager::DoMaintenance(bool bForceFlush, bool fSync) {
                  cache_entry_count,
                  erase_entry_count,
                  ElapsedMillis(maintenance_start));
-        return m_evoDb->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync);
+        return m_evoDb->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync) &&
+               m_evoDbDiffs->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync);
     }
 
     const uint256 tip_hash = tip->GetBlockHash();
-    const size_t cache_entry_count{m_evoDb->GetReadWriteCacheSize()};
-    const size_t erase_entry_count{m_evoDb->GetEraseCacheSize()};
+    const size_t cache_entry_count{m_evoDb->GetReadWriteCacheSize() + m_evoDbDiffs->GetReadWriteCacheSize()};
+    const size_t erase_entry_count{m_evoDb->GetEraseCacheSize() + m_evoDbDiffs->GetEraseCacheSize()};
     const bool persistent_window_initialized =
         m_persistent_window_initialized.load(std::memory_order_relaxed);
 
@@ -1186,6 +1321,19 @@ bool CDeterministicMNManager::DoMaintenance(bool bForceFlush, bool fSync) {
     EvoEraseSet retained_hashes;
     retained_hashes.reserve(LIST_CACHE_SIZE * 2);
     CollectRetainedSnapshotHashes(tip, retained_hashes_ordered, retained_hashes);
+    // a retained list stored as a diff also needs the diffs back to its full list, and that list
+    if (!retained_hashes_ordered.empty()) {
+        const int nDIP0003Height = Params().GetConsensus().DIP0003Height;
+        int steps{0};
+        for (const CBlockIndex* pindex = tip->GetAncestor(tip->nHeight - int(retained_hashes_ordered.size()) + 1);
+             pindex != nullptr && pindex->nHeight >= nDIP0003Height && steps++ < DISK_SNAPSHOT_PERIOD &&
+             !m_evoDb->ExistsCache(pindex->GetBlockHash());
+             pindex = pindex->pprev) {
+            if (pindex->pprev != nullptr) {
+                retained_hashes.insert(pindex->pprev->GetBlockHash());
+            }
+        }
+    }
 
     LogPrint(BCLog::SYS,
              "CDeterministicMNManager::%s maintenance start tip=%s height=%d dirty=%zu erase=%zu retained=%zu persistent_window_initialized=%d\n",
@@ -1198,7 +1346,8 @@ bool CDeterministicMNManager::DoMaintenance(bool bForceFlush, bool fSync) {
              persistent_window_initialized);
 
     if ((cache_entry_count != 0 || erase_entry_count != 0) &&
-        !m_evoDb->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync)) {
+        (!m_evoDb->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync) ||
+         !m_evoDbDiffs->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync))) {
         return false;
     }
 
@@ -1208,6 +1357,12 @@ bool CDeterministicMNManager::DoMaintenance(bool bForceFlush, bool fSync) {
             *m_evoDb, retained_hashes, prune_keys, persisted_snapshot_count)) {
         return false;
     }
+    std::vector<uint256> prune_diff_keys;
+    size_t persisted_diff_count{0};
+    if (!CollectPersistedKeysOutsideWindow(
+            *m_evoDbDiffs, retained_hashes, prune_diff_keys, persisted_diff_count)) {
+        return false;
+    }
 
     for (const uint256& key : prune_keys) {
         m_evoDb->EraseCache(key);
@@ -1215,24 +1370,34 @@ bool CDeterministicMNManager::DoMaintenance(bool bForceFlush, bool fSync) {
     if (!prune_keys.empty() && !m_evoDb->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync)) {
         return false;
     }
+    for (const uint256& key : prune_diff_keys) {
+        m_evoDbDiffs->EraseCache(key);
+    }
+    if (!prune_diff_keys.empty() && !m_evoDbDiffs->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync)) {
+        return false;
+    }
 
     const bool should_initialize_hot_cache =
         !persistent_window_initialized && !retained_hashes_ordered.empty();
     if (should_initialize_hot_cache) {
-        m_evoDb->SetReadCacheSize(HOT_LIST_CACHE_SIZE);
-        if (!WarmReadCacheFromWindow(*m_evoDb, retained_hashes_ordered)) {
-            return false;
+        // lists stored as diffs are kept hot by mapHotLists instead
+        if (!m_diff_storage) {
+            m_evoDb->SetReadCacheSize(HOT_LIST_CACHE_SIZE);
+            if (!WarmReadCacheFromWindow(*m_evoDb, retained_hashes_ordered)) {
+                return false;
+            }
         }
         m_persistent_window_initialized.store(true, std::memory_order_relaxed);
     }
 
     WITH_LOCK(cs, m_last_maintained_tip = tip_hash;);
     LogPrint(BCLog::SYS,
-             "CDeterministicMNManager::%s maintenance complete tip=%s persisted=%zu pruned=%zu read_cache=%zu initialized_hot_cache=%d elapsed=%d ms\n",
+             "CDeterministicMNManager::%s maintenance complete tip=%s persisted=%zu diffs=%zu pruned=%zu read_cache=%zu initialized_hot_cache=%d elapsed=%d ms\n",
              __func__,
              tip_hash.ToString(),
              persisted_snapshot_count,
-             prune_keys.size(),
+             persisted_diff_count,
+             prune_keys.size() + prune_diff_keys.size(),
              m_evoDb->GetReadCacheSize(),
              should_initialize_hot_cache,
              ElapsedMillis(maintenance_start));
@@ -14,11 +14,14 @@
 #include <saltedhasher.h>
 #include <scheduler.h>
 #include <sync.h>
+#include <unordered_lru_cache.h>
 
+#include <immer/flex_vector.hpp>
 #include <immer/map.hpp>
 
 #include <atomic>
 #include <limits>
+#include <list>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -88,6 +91,9 @@ public:
     using MnMap = immer::map<uint256, CDeterministicMNCPtr, ImmerHasher>;
     using MnInternalIdMap = immer::map<uint64_t, uint256>;
     using MnUniquePropertyMap = immer::map<uint256, std::pair<uint256, uint32_t>, ImmerHasher>;
+    // (last paid height, proTxHash) of the valid MNs in payment order
+    using MnPayeeKey = std::pair<int, uint256>;
+    using MnPayeeIndex = immer::flex_vector<MnPayeeKey>;
     bool m_changed_nevm_address{false};
 private:
     uint256 blockHash;
@@ -99,6 +105,8 @@ private:
     // map of unique properties like address and keys
     // we keep track of this as checking for duplicates would otherwise be painfully slow
     MnUniquePropertyMap mnUniquePropertyMap;
+    // kept sorted next to mnMap so the next payees are found without scanning or sorting the whole list
+    MnPayeeIndex mnPayeeIndex;
 
 public:
     CDeterministicMNList() = default;
@@ -128,6 +136,7 @@ public:
         mnMap = MnMap();
         mnUniquePropertyMap = MnUniquePropertyMap();
         mnInternalIdMap = MnInternalIdMap();
+        mnPayeeIndex = MnPayeeIndex();
         s >> blockHash;
         s >> nHeight;
         s >> nTotalRegisteredCount;
@@ -141,6 +150,7 @@ public:
         mnMap = MnMap();
         mnUniquePropertyMap = MnUniquePropertyMap();
         mnInternalIdMap = MnInternalIdMap();
+        mnPayeeIndex = MnPayeeIndex();
         blockHash.SetNull();
         nHeight = -1;
         nTotalRegisteredCount = 0;
@@ -256,6 +266,8 @@ public:
      */
     [[nodiscard]] std::vector<CDeterministicMNCPtr> CalculateQuorum(size_t maxSize, const uint256& modifier) const;
     [[nodiscard]] std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>> CalculateScores(const uint256& modifier) const;
+    // SYSCOIN the maxSize best scored MNs, in descending order
+    [[nodiscard]] static std::vector<CDeterministicMNCPtr> SelectQuorum(std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>> scores, size_t maxSize);
 
     /**
      * Calculates the maximum penalty which is allowed at the height of this MN list. It is dynamic and might change
@@ -315,6 +327,10 @@ public:
     }
 
 private:
+    static MnPayeeKey GetPayeeKey(const CDeterministicMN& dmn);
+    void AddToPayeeIndex(const CDeterministicMN& dmn);
+    void RemoveFromPayeeIndex(const CDeterministicMN& dmn);
+
     template <typename T>
     [[nodiscard]] uint256 GetUniquePropertyHash(const T& v) const
     {
@@ -478,6 +494,7 @@ public:
         return !addedMNs.empty() || !updatedMNs.empty() || !removedMns.empty();
     }
 };
+static constexpr bool DEFAULT_EVODB_DIFFS{false};
 class CDeterministicMNManager
 {
 public:
@@ -494,6 +511,14 @@ private:
 
     const CBlockIndex* tipIndex GUARDED_BY(cs) {nullptr};
     uint256 m_last_maintained_tip GUARDED_BY(cs);
+    // Write a full list every DISK_SNAPSHOT_PERIOD blocks and only per-block diffs in between
+    const bool m_diff_storage;
+    // Recently built lists, so that lists stored as diffs are not replayed on every lookup
+    std::unordered_map<uint256, CDeterministicMNList, StaticSaltedHasher> mapHotLists GUARDED_BY(cs);
+    std::list<uint256> listHotOrder GUARDED_BY(cs);
+    // SYSCOIN scores of the lists of connected blocks, which never change. Every DKG phase asks for the same ones again
+    Mutex cs_scores;
+    unordered_lru_cache<uint256, std::vector<std::pair<arith_uint256, CDeterministicMNCPtr>>, StaticSaltedHasher, 16> mapScores GUARDED_BY(cs_scores);
 public:
     struct EvoDBStats {
         int64_t approxPersistedEntries{0};
@@ -503,7 +528,9 @@ public:
         std::string dbPath;
     };
     std::unique_ptr<CEvoDB<uint256, CDeterministicMNList, StaticSaltedHasher>> m_evoDb;
-    explicit CDeterministicMNManager(const DBParams& db_params);
+    // Diffs against the list of the previous block, read even when not writing diffs so the mode can be switched off
+    std::unique_ptr<CEvoDB<uint256, CDeterministicMNListDiff, StaticSaltedHasher>> m_evoDbDiffs;
+    explicit CDeterministicMNManager(const DBParams& db_params, bool diff_storage = DEFAULT_EVODB_DIFFS);
        
     ~CDeterministicMNManager() = default;
 
@@ -520,6 +547,7 @@ public:
     const CDeterministicMNList GetListForBlock(const CBlockIndex* pindex) EXCLUSIVE_LOCKS_REQUIRED(!cs);
     void GetListForBlock(const CBlockIndex* pindex, CDeterministicMNList& list);
     const CDeterministicMNList GetListAtChainTip() EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    std::vector<CDeterministicMNCPtr> CalculateQuorum(const CBlockIndex* pindex, size_t maxSize, const uint256& modifier) EXCLUSIVE_LOCKS_REQUIRED(!cs, !cs_scores);
 
     // Test if given TX is a ProRegTx which also contains the collateral at index n
     static bool IsProTxWithCollateral(const CTransactionRef& tx, uint32_t n);
@@ -531,6 +559,10 @@ public:
     bool HasPersistentWindow() const;
 private:
     const CDeterministicMNList GetListForBlockInternal(const CBlockIndex* pindex) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    bool ReadListForBlock(const CBlockIndex* pindex, CDeterministicMNList& list) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    bool HasStoredList(const CBlockIndex* pindex) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    bool ReadHotList(const uint256& blockHash, CDeterministicMNList& list) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    void AddHotList(const CDeterministicMNList& list) EXCLUSIVE_LOCKS_REQUIRED(!cs);
 };
 extern int64_t DEFAULT_MAX_RECOVERED_SIGS_AGE; // keep them for a week
 extern std::unique_ptr<CDeterministicMNManager> deterministicMNManager;
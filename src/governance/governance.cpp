@@ -8,6 +8,7 @@
 #include <chain.h>
 #include <chainparams.h>
 #include <consensus/validation.h>
+#include <dbwrapper.h>
 #include <deploymentstatus.h>
 #include <evo/deterministicmns.h>
 #include <flatdatabase.h>
@@ -21,10 +22,13 @@
 #include <netfulfilledman.h>
 #include <netmessagemaker.h>
 #include <protocol.h>
+#include <random.h>
 #include <shutdown.h>
 #include <spork.h>
+#include <util/string.h>
 #include <util/time.h>
 #include <validation.h>
+#include <version.h>
 #include <timedata.h>
 std::unique_ptr<CGovernanceManager> governance;
 int nSubmittedFinalBudget;
@@ -61,13 +65,69 @@ CGovernanceManager::CGovernanceManager(ChainstateManager& _chainman) :
 CGovernanceManager::~CGovernanceManager()
 {
     if (!is_valid) return;
-    m_db->Store(*this);
+    WriteStore(/*fSync=*/true);
 }
 
+// SYSCOIN
+namespace {
+const std::string DB_GOVERNANCE_VERSION{"gov_v"};
+const std::string DB_GOVERNANCE_OBJECT{"gov_o"};
+const std::string DB_GOVERNANCE_ERASED{"gov_e"};
+const std::string DB_GOVERNANCE_LAST_OBJECT{"gov_l"};
+const std::string DB_GOVERNANCE_MN_LIST{"gov_m"};
+
+// Governance objects only carry their votes in the disk serialization, which CDBWrapper's streams don't select
+template <typename T>
+std::vector<unsigned char> SerializeForStore(const T& obj)
+{
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << obj;
+    const auto bytes = UCharSpanCast(Span{ss});
+    return {bytes.begin(), bytes.end()};
+}
+
+template <typename T>
+bool UnserializeFromStore(const std::vector<unsigned char>& vch, T& obj)
+{
+    try {
+        CDataStream ss(Span{vch}, SER_DISK, CLIENT_VERSION);
+        ss >> obj;
+    } catch (const std::exception& e) {
+        LogPrintf("CGovernanceManager::%s -- failed to deserialize: %s\n", __func__, e.what());
+        return false;
+    }
+    return true;
+}
+} // namespace
+
 bool CGovernanceManager::LoadCache(bool load_cache)
 {
     assert(m_db != nullptr);
-    is_valid = load_cache ? m_db->Load(*this) : m_db->Store(*this);
+    const fs::path storePath = gArgs.GetDataDirNet() / "governance";
+    const fs::path legacyPath = gArgs.GetDataDirNet() / "governance.dat";
+    m_store = std::make_unique<CDBWrapper>(DBParams{storePath, 8 << 20, false, /*wipe_data=*/!load_cache});
+
+    std::string strVersion;
+    if (!load_cache) {
+        is_valid = WriteStore(/*fSync=*/true);
+    } else if (m_store->Read(DB_GOVERNANCE_VERSION, strVersion)) {
+        if (strVersion == SERIALIZATION_VERSION_STRING) {
+            is_valid = LoadFromStore();
+        } else {
+            LogPrintf("CGovernanceManager::%s -- unknown store version %s, starting from scratch\n", __func__, strVersion);
+            // release the LevelDB lock before reopening the same path
+            m_store.reset();
+            m_store = std::make_unique<CDBWrapper>(DBParams{storePath, 8 << 20, false, /*wipe_data=*/true});
+            is_valid = WriteStore(/*fSync=*/true);
+        }
+    } else {
+        // nothing was written to the store yet, take over the flat file snapshot of older versions if there is one
+        is_valid = (!fs::exists(legacyPath) || m_db->Load(*this)) && WriteStore(/*fSync=*/true);
+    }
+    if (is_valid && fs::exists(legacyPath)) {
+        fs::remove(legacyPath);
+    }
+
     if (is_valid && load_cache) {
         CheckAndRemove();
         InitOnLoad();
@@ -75,6 +135,89 @@ bool CGovernanceManager::LoadCache(bool load_cache)
     return is_valid;
 }
 
+bool CGovernanceManager::LoadFromStore()
+{
+    const int64_t nStart = TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now());
+
+    LOCK(cs);
+    std::unique_ptr<CDBIterator> pcursor(m_store->NewIterator());
+    auto key = std::make_pair(DB_GOVERNANCE_OBJECT, uint256());
+    for (pcursor->Seek(key); pcursor->Valid(); pcursor->Next()) {
+        if (!pcursor->GetKey(key) || key.first != DB_GOVERNANCE_OBJECT) {
+            break;
+        }
+        std::vector<unsigned char> vch;
+        auto& govobj = mapObjects[key.second];
+        if (!pcursor->GetValue(vch) || !UnserializeFromStore(vch, govobj) || govobj.GetHash() != key.second) {
+            LogPrintf("CGovernanceManager::%s -- dropping unreadable object %s\n", __func__, key.second.ToString());
+            mapObjects.erase(key.second);
+            setStoreErasedObjects.insert(key.second);
+            continue;
+        }
+        govobj.ClearDirtyStore();
+    }
+    pcursor.reset();
+
+    std::vector<unsigned char> vch;
+    if (m_store->Read(DB_GOVERNANCE_ERASED, vch)) {
+        UnserializeFromStore(vch, mapErasedGovernanceObjects);
+    }
+    if (m_store->Read(DB_GOVERNANCE_LAST_OBJECT, vch)) {
+        UnserializeFromStore(vch, mapLastMasternodeObject);
+    }
+    if (m_store->Read(DB_GOVERNANCE_MN_LIST, vch) && UnserializeFromStore(vch, *lastMNListForVotingKeys)) {
+        storedMNListHash = lastMNListForVotingKeys->GetBlockHash();
+    }
+    fStoreErasedDirty = false;
+    fStoreLastObjectDirty = false;
+
+    LogPrintf("Loaded %d governance objects from store  %dms\n", mapObjects.size(), TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now()) - nStart);
+    return true;
+}
+
+// Writes the objects that changed since the last call and the (small) manager state. Orphan and invalid
+// vote caches are not persisted, they are short lived and get rebuilt from the network.
+bool CGovernanceManager::WriteStore(bool fSync)
+{
+    if (!m_store) return false;
+
+    CDBBatch batch(*m_store);
+    size_t nWritten{0}, nErased{0};
+    {
+        LOCK(cs);
+        batch.Write(DB_GOVERNANCE_VERSION, SERIALIZATION_VERSION_STRING);
+        // erase first, an object can come back before the next write
+        for (const auto& nHash : setStoreErasedObjects) {
+            batch.Erase(std::make_pair(DB_GOVERNANCE_OBJECT, nHash));
+        }
+        nErased = setStoreErasedObjects.size();
+        setStoreErasedObjects.clear();
+        for (auto& [nHash, govobj] : mapObjects) {
+            if (!govobj.IsSetDirtyStore()) continue;
+            batch.Write(std::make_pair(DB_GOVERNANCE_OBJECT, nHash), SerializeForStore(govobj));
+            govobj.ClearDirtyStore();
+            ++nWritten;
+        }
+        if (fStoreErasedDirty) {
+            batch.Write(DB_GOVERNANCE_ERASED, SerializeForStore(mapErasedGovernanceObjects));
+            fStoreErasedDirty = false;
+        }
+        if (fStoreLastObjectDirty) {
+            batch.Write(DB_GOVERNANCE_LAST_OBJECT, SerializeForStore(mapLastMasternodeObject));
+            fStoreLastObjectDirty = false;
+        }
+        if (lastMNListForVotingKeys->GetBlockHash() != storedMNListHash) {
+            batch.Write(DB_GOVERNANCE_MN_LIST, SerializeForStore(*lastMNListForVotingKeys));
+            storedMNListHash = lastMNListForVotingKeys->GetBlockHash();
+        }
+    }
+    if (!m_store->WriteBatch(batch, fSync)) {
+        return false;
+    }
+    LogPrint(BCLog::GOBJECT, "CGovernanceManager::%s -- wrote %d objects, erased %d\n", __func__, nWritten, nErased);
+    return true;
+}
+
 // Accessors for thread-safe access to maps
 bool CGovernanceManager::HaveObjectForHash(const uint256& nHash) const
 {
@@ -144,12 +287,25 @@ void CGovernanceManager::ProcessMessage(CNode* pfrom, const std::string& strComm
             return;
         }
 
+        // SYSCOIN newer peers may replace the filter with a sketch of the votes they know
+        std::optional<CGovernanceVoteSketch> sketch;
+        if (pfrom->GetCommonVersion() >= GOVERNANCE_VOTE_SKETCH_VERSION && !vRecv.empty()) {
+            vRecv >> sketch.emplace();
+            if (!sketch->IsValid()) {
+                const PeerRef peer{peerman.GetPeerRef(pfrom->GetId())};
+                if (peer) {
+                    peerman.Misbehaving(*peer, 100, "invalid governance vote sketch");
+                }
+                return;
+            }
+        }
+
         LogPrint(BCLog::GOBJECT, "MNGOVERNANCESYNC -- syncing governance objects to our peer %s\n", pfrom->addr.ToStringAddr());
         if (nProp == uint256()) {
             SyncObjects(pfrom, connman, peerman);
             return;
         } else {
-            SyncSingleObjVotes(pfrom, nProp, filter, connman, peerman);
+            SyncSingleObjVotes(pfrom, nProp, filter, sketch, connman, peerman);
         }
     }
 
@@ -308,6 +464,7 @@ void CGovernanceManager::CheckOrphanVotes(CGovernanceObject& govobj, PeerManager
         if (pairVote.second < nNow) {
             fRemove = true;
         } else if (govobj.ProcessVote(tip_mn_list, vote, e)) {
+            mapMasternodeVotedObjects[vote.GetMasternodeOutpoint()].insert(nHash);
             vote.Relay(peerman, tip_mn_list);
             fRemove = true;
         }
@@ -444,6 +601,9 @@ void CGovernanceManager::CheckAndRemove()
             }
 
             mapErasedGovernanceObjects.insert(std::make_pair(nHash, nTimeExpired));
+            fStoreErasedDirty = true;
+            RemoveFromMasternodeVoteIndex(*pObj);
+            setStoreErasedObjects.insert(nHash);
             mapObjects.erase(it++);
         } else {
             if (pObj->GetObjectType() == GOVERNANCE_OBJECT_PROPOSAL) {
@@ -462,6 +622,7 @@ void CGovernanceManager::CheckAndRemove()
     while (s_it != mapErasedGovernanceObjects.end()) {
         if (s_it->second < nNow) {
             mapErasedGovernanceObjects.erase(s_it++);
+            fStoreErasedDirty = true;
         } else {
             ++s_it;
         }
@@ -504,53 +665,24 @@ void CGovernanceManager::DeleteGovernanceObject(const uint256& nHash)
 {
     LOCK(cs);
 
-    if (mapObjects.count(nHash)) {
-        mapObjects.erase(nHash);
+    auto it = mapObjects.find(nHash);
+    if (it != mapObjects.end()) {
+        RemoveFromMasternodeVoteIndex(it->second);
+        setStoreErasedObjects.insert(nHash);
+        mapObjects.erase(it);
     }
 }
 
 std::vector<CGovernanceVote> CGovernanceManager::GetCurrentVotes(const uint256& nParentHash, const COutPoint& mnCollateralOutpointFilter) const
 {
     LOCK(cs);
-    std::vector<CGovernanceVote> vecResult;
 
     // Find the governance object or short-circuit.
     auto it = mapObjects.find(nParentHash);
-    if (it == mapObjects.end()) return vecResult;
-    const CGovernanceObject& govobj = it->second;
-
-    const auto tip_mn_list = deterministicMNManager->GetListAtChainTip();
-    std::map<COutPoint, CDeterministicMNCPtr> mapMasternodes;
-    if (mnCollateralOutpointFilter.IsNull()) {
-        tip_mn_list.ForEachMNShared(false, [&](const CDeterministicMNCPtr& dmn) {
-            mapMasternodes.emplace(dmn->collateralOutpoint, dmn);
-        });
-    } else {
-        auto dmn = tip_mn_list.GetMNByCollateral(mnCollateralOutpointFilter);
-        if (dmn) {
-            mapMasternodes.emplace(dmn->collateralOutpoint, dmn);
-        }
-    }
-
-    // Loop through each MN collateral outpoint and get the votes for the `nParentHash` governance object
-    for (const auto& mnpair : mapMasternodes) {
-        // get a vote_rec_t from the govobj
-        vote_rec_t voteRecord;
-        if (!govobj.GetCurrentMNVotes(mnpair.first, voteRecord)) continue;
-
-        for (const auto& voteInstancePair : voteRecord.mapInstances) {
-            int signal = voteInstancePair.first;
-            int outcome = voteInstancePair.second.eOutcome;
-            int64_t nCreationTime = voteInstancePair.second.nCreationTime;
-
-            CGovernanceVote vote = CGovernanceVote(mnpair.first, nParentHash, (vote_signal_enum_t)signal, (vote_outcome_enum_t)outcome);
-            vote.SetTime(nCreationTime);
+    if (it == mapObjects.end()) return {};
 
-            vecResult.push_back(vote);
-        }
-    }
-
-    return vecResult;
+    // Only votes of masternodes that are still in the list are current
+    return it->second.GetCurrentVotes(deterministicMNManager->GetListAtChainTip(), mnCollateralOutpointFilter);
 }
 
 void CGovernanceManager::GetAllNewerThan(std::vector<CGovernanceObject>& objs, int64_t nMoreThanTime) const
@@ -862,7 +994,7 @@ bool CGovernanceManager::ConfirmInventoryRequest(const GenTxid& gtxid)
     return true;
 }
 
-void CGovernanceManager::SyncSingleObjVotes(CNode* pnode, const uint256& nProp, const CBloomFilter& filter, CConnman& connman, PeerManager& peerman)
+void CGovernanceManager::SyncSingleObjVotes(CNode* pnode, const uint256& nProp, const CBloomFilter& filter, const std::optional<CGovernanceVoteSketch>& sketch, CConnman& connman, PeerManager& peerman)
 {
     // do not provide any data until our node is synced
     if (!masternodeSync.IsSynced()) return;
@@ -896,12 +1028,36 @@ void CGovernanceManager::SyncSingleObjVotes(CNode* pnode, const uint256& nProp,
         const auto tip_mn_list = deterministicMNManager->GetListAtChainTip();
 
         auto votes = fileVotes.GetVotes();
+
+        // With a sketch only the votes in the symmetric difference are announced. If the difference doesn't fit
+        // into the sketch, the filter sent along with it decides as it does for older peers.
+        std::optional<std::set<uint32_t>> setDifference;
+        if (sketch) {
+            std::vector<uint256> vecVoteHashes;
+            vecVoteHashes.reserve(votes.size());
+            for (const auto& vote : votes) {
+                vecVoteHashes.emplace_back(vote.GetHash());
+            }
+            if (const auto difference = sketch->Reconcile(vecVoteHashes)) {
+                setDifference.emplace(difference->begin(), difference->end());
+            }
+            LogPrint(BCLog::GOBJECT, "CGovernanceManager::%s -- reconciled %d votes with sketch of capacity %d, difference %s, peer=%d\n", __func__,
+                vecVoteHashes.size(), sketch->nCapacity, setDifference ? ::ToString(setDifference->size()) : "too large", pnode->GetId());
+        }
+
         for (const auto &vote : votes) {
             const uint256 nVoteHash = vote.GetHash();
 
             bool onlyVotingKeyAllowed = govobj.GetObjectType() == GOVERNANCE_OBJECT_PROPOSAL && vote.GetSignal() == VOTE_SIGNAL_FUNDING;
 
-            if (filter.contains(nVoteHash) || !vote.IsValid(tip_mn_list, onlyVotingKeyAllowed)) {
+            if (setDifference) {
+                if (!setDifference->count(sketch->GetShortId(nVoteHash))) {
+                    continue;
+                }
+            } else if (filter.contains(nVoteHash)) {
+                continue;
+            }
+            if (!vote.IsValid(tip_mn_list, onlyVotingKeyAllowed)) {
                 continue;
             }
             PeerRef peer = peerman.GetPeerRef(pnode->GetId());
@@ -968,8 +1124,10 @@ void CGovernanceManager::SyncObjects(CNode* pnode, CConnman& connman, PeerManage
 
 void CGovernanceManager::MasternodeRateUpdate(const CGovernanceObject& govobj)
 {
+    AssertLockHeld(cs);
     if (govobj.GetObjectType() != GOVERNANCE_OBJECT_TRIGGER) return;
 
+    fStoreLastObjectDirty = true;
     const COutPoint& masternodeOutpoint = govobj.GetMasternodeOutpoint();
     auto it = mapLastMasternodeObject.find(masternodeOutpoint);
 
@@ -1052,8 +1210,9 @@ bool CGovernanceManager::MasternodeRateCheck(const CGovernanceObject& govobj, bo
     LogPrint(BCLog::GOBJECT, "CGovernanceManager::MasternodeRateCheck -- Rate too high: object hash = %s, masternode = %s, object timestamp = %d, rate = %f, max rate = %f\n",
         strHash, masternodeOutpoint.ToStringShort(), nTimestamp, dRate, dMaxRate);
 
-    if (fUpdateFailStatus) {
+    if (fUpdateFailStatus && it->second.fStatusOK) {
         it->second.fStatusOK = false;
+        fStoreLastObjectDirty = true;
     }
 
     return false;
@@ -1144,6 +1303,9 @@ bool CGovernanceManager::ProcessVote(CNode* pfrom, const CGovernanceVote& vote,
     }
 
     bool fOk = govobj.ProcessVote(deterministicMNManager->GetListAtChainTip(), vote, exception) && cmapVoteToObject.Insert(nHashVote, &govobj);
+    if (fOk) {
+        mapMasternodeVotedObjects[vote.GetMasternodeOutpoint()].insert(govobj.GetHash());
+    }
     LEAVE_CRITICAL_SECTION(cs);
     LEAVE_CRITICAL_SECTION(chainman.GetMutex());
     return fOk;
@@ -1226,6 +1388,7 @@ void CGovernanceManager::RequestGovernanceObject(CNode* pfrom, const uint256& nH
     CNetMsgMaker msgMaker(pfrom->GetCommonVersion());
 
     CBloomFilter filter;
+    std::optional<CGovernanceVoteSketch> sketch;
 
     size_t nVoteCount = 0;
     if (fUseFilter) {
@@ -1233,17 +1396,31 @@ void CGovernanceManager::RequestGovernanceObject(CNode* pfrom, const uint256& nH
         const CGovernanceObject* pObj = FindConstGovernanceObject(nHash);
 
         if (pObj) {
-            filter = CBloomFilter(Params().GetConsensus().nGovernanceFilterElements, GOVERNANCE_FILTER_FP_RATE, GetRand(999999), BLOOM_UPDATE_ALL);
             std::vector<CGovernanceVote> vecVotes = pObj->GetVoteFile().GetVotes();
             nVoteCount = vecVotes.size();
+            filter = CBloomFilter(Params().GetConsensus().nGovernanceFilterElements, GOVERNANCE_FILTER_FP_RATE, GetRand(999999), BLOOM_UPDATE_ALL);
             for (const auto& vote : vecVotes) {
                 filter.insert(vote.GetHash());
             }
+            if (nVoteCount > 0 && pfrom->GetCommonVersion() >= GOVERNANCE_VOTE_SKETCH_VERSION) {
+                // SYSCOIN the sketch is tried first, the filter is still sent for when the difference doesn't fit into it
+                std::vector<uint256> vecVoteHashes;
+                vecVoteHashes.reserve(nVoteCount);
+                for (const auto& vote : vecVotes) {
+                    vecVoteHashes.emplace_back(vote.GetHash());
+                }
+                FastRandomContext rng;
+                sketch.emplace(rng.rand64(), rng.rand64(), CGovernanceVoteSketch::CapacityForVoteCount(nVoteCount), vecVoteHashes);
+            }
         }
     }
 
-    LogPrint(BCLog::GOBJECT, "CGovernanceManager::RequestGovernanceObject -- nHash %s nVoteCount %d peer=%d\n", nHash.ToString(), nVoteCount, pfrom->GetId());
-    connman.PushMessage(pfrom, msgMaker.Make(NetMsgType::MNGOVERNANCESYNC, nHash, filter));
+    LogPrint(BCLog::GOBJECT, "CGovernanceManager::RequestGovernanceObject -- nHash %s nVoteCount %d sketch %d peer=%d\n", nHash.ToString(), nVoteCount, sketch.has_value(), pfrom->GetId());
+    if (sketch) {
+        connman.PushMessage(pfrom, msgMaker.Make(NetMsgType::MNGOVERNANCESYNC, nHash, filter, *sketch));
+    } else {
+        connman.PushMessage(pfrom, msgMaker.Make(NetMsgType::MNGOVERNANCESYNC, nHash, filter));
+    }
 }
 
 int CGovernanceManager::RequestGovernanceObjectVotes(CNode* pnode, CConnman& connman, const PeerManager& peerman) const
@@ -1383,12 +1560,31 @@ void CGovernanceManager::RebuildIndexes()
     LOCK(cs);
 
     cmapVoteToObject.Clear();
+    mapMasternodeVotedObjects.clear();
     for (auto& objPair : mapObjects) {
         CGovernanceObject& govobj = objPair.second;
         std::vector<CGovernanceVote> vecVotes = govobj.GetVoteFile().GetVotes();
         for (const auto& vecVote : vecVotes) {
             cmapVoteToObject.Insert(vecVote.GetHash(), &govobj);
         }
+        for (const auto& outpoint : govobj.GetVotingMasternodes()) {
+            mapMasternodeVotedObjects[outpoint].insert(objPair.first);
+        }
+    }
+}
+
+void CGovernanceManager::RemoveFromMasternodeVoteIndex(const CGovernanceObject& govobj)
+{
+    AssertLockHeld(cs);
+
+    const uint256 nHash = govobj.GetHash();
+    for (const auto& outpoint : govobj.GetVotingMasternodes()) {
+        auto it = mapMasternodeVotedObjects.find(outpoint);
+        if (it == mapMasternodeVotedObjects.end()) continue;
+        it->second.erase(nHash);
+        if (it->second.empty()) {
+            mapMasternodeVotedObjects.erase(it);
+        }
     }
 }
 
@@ -1431,6 +1627,7 @@ void GovernanceStore::Clear()
     mapObjects.clear();
     mapErasedGovernanceObjects.clear();
     cmapVoteToObject.Clear();
+    mapMasternodeVotedObjects.clear();
     cmapInvalidVotes.Clear();
     cmmapOrphanVotes.Clear();
     mapLastMasternodeObject.clear();
@@ -1597,18 +1794,35 @@ void CGovernanceManager::RemoveInvalidVotes()
         changedKeyMNs.emplace_back(oldDmn->collateralOutpoint);
     }
 
+    // only visit the objects the changed masternodes actually voted on
     for (const auto& outpoint : changedKeyMNs) {
-        for (auto& p : mapObjects) {
-            auto removed = p.second.RemoveInvalidVotes(tip_mn_list, outpoint);
-            if (removed.empty()) {
+        auto indexIt = mapMasternodeVotedObjects.find(outpoint);
+        if (indexIt == mapMasternodeVotedObjects.end()) {
+            continue;
+        }
+        auto& votedObjects = indexIt->second;
+        for (auto hashIt = votedObjects.begin(); hashIt != votedObjects.end(); ) {
+            auto objIt = mapObjects.find(*hashIt);
+            if (objIt == mapObjects.end()) {
+                hashIt = votedObjects.erase(hashIt);
                 continue;
             }
+            auto removed = objIt->second.RemoveInvalidVotes(tip_mn_list, outpoint);
             for (auto& voteHash : removed) {
                 cmapVoteToObject.Erase(voteHash);
                 cmapInvalidVotes.Erase(voteHash);
                 cmmapOrphanVotes.Erase(voteHash);
                 setRequestedVotes.erase(voteHash);
             }
+            vote_rec_t voteRecord;
+            if (!objIt->second.GetCurrentMNVotes(outpoint, voteRecord) || voteRecord.mapInstances.empty()) {
+                hashIt = votedObjects.erase(hashIt);
+            } else {
+                ++hashIt;
+            }
+        }
+        if (votedObjects.empty()) {
+            mapMasternodeVotedObjects.erase(indexIt);
         }
     }
 
@@ -1617,6 +1831,9 @@ void CGovernanceManager::RemoveInvalidVotes()
 }
 bool CGovernanceManager::FlushCacheToDisk(bool fSync)
 {
+    if (is_valid && !WriteStore(fSync)) {
+        return false;
+    }
     return m_sb->FlushCacheToDisk(/*CHUNK_ITEMS=*/256, fSync);
 }
 bool CGovernanceManager::UndoBlock(const CBlockIndex* pindex)
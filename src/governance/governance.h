@@ -6,6 +6,7 @@
 #define SYSCOIN_GOVERNANCE_GOVERNANCE_H
 
 #include <governance/governanceobject.h>
+#include <governance/governancevotesketch.h>
 
 #include <cachemap.h>
 #include <cachemultimap.h>
@@ -18,6 +19,7 @@
 class CBloomFilter;
 class CBlockIndex;
 class CConnman;
+class CDBWrapper;
 template<typename T>
 class CFlatDB;
 class CInv;
@@ -175,6 +177,8 @@ protected:
     //   value - expiration time for deleted objects
     std::map<uint256, int64_t> mapErasedGovernanceObjects;
     object_ref_cm_t cmapVoteToObject;
+    // SYSCOIN masternode collateral -> hashes of the objects it currently has votes on, not serialized
+    std::map<COutPoint, std::set<uint256>> mapMasternodeVotedObjects GUARDED_BY(cs);
     CacheMap<uint256, CGovernanceVote> cmapInvalidVotes;
     vote_cmm_t cmmapOrphanVotes;
     txout_m_t mapLastMasternodeObject;
@@ -261,7 +265,17 @@ private:
 
 private:
     ChainstateManager& chainman;
+    // SYSCOIN only used to migrate the flat file snapshot written by older versions
     const std::unique_ptr<db_type> m_db;
+    // objects are written to this store as they change, the small manager state on every flush
+    std::unique_ptr<CDBWrapper> m_store;
+    // hashes of objects that were removed since the last write to m_store
+    std::set<uint256> setStoreErasedObjects GUARDED_BY(cs);
+    // block hash of the voting key MN list last written to m_store
+    uint256 storedMNListHash GUARDED_BY(cs);
+    // whether the erased-object hashes and the per-masternode rate buffers changed since the last write to m_store
+    bool fStoreErasedDirty GUARDED_BY(cs){true};
+    bool fStoreLastObjectDirty GUARDED_BY(cs){true};
     bool is_valid{false};
 
 
@@ -293,7 +307,7 @@ public:
      */
     bool ConfirmInventoryRequest(const GenTxid& gtxid);
 
-    void SyncSingleObjVotes(CNode* pnode, const uint256& nProp, const CBloomFilter& filter, CConnman& connman, PeerManager& peerman);
+    void SyncSingleObjVotes(CNode* pnode, const uint256& nProp, const CBloomFilter& filter, const std::optional<CGovernanceVoteSketch>& sketch, CConnman& connman, PeerManager& peerman);
     void SyncObjects(CNode* pnode, CConnman& connman, PeerManager &peerman) const;
 
     void ProcessMessage(CNode* pfrom, const std::string& strCommand, CDataStream& vRecv, CConnman& connman, PeerManager& peerman);
@@ -340,7 +354,7 @@ public:
         mapPostponedObjects.insert(std::make_pair(govobj.GetHash(), govobj));
     }
 
-    void MasternodeRateUpdate(const CGovernanceObject& govobj);
+    void MasternodeRateUpdate(const CGovernanceObject& govobj) EXCLUSIVE_LOCKS_REQUIRED(cs);
 
     bool MasternodeRateCheck(const CGovernanceObject& govobj, bool fUpdateFailStatus = false);
 
@@ -399,6 +413,11 @@ private:
 
     void RebuildIndexes();
 
+    void RemoveFromMasternodeVoteIndex(const CGovernanceObject& govobj) EXCLUSIVE_LOCKS_REQUIRED(cs);
+
+    bool LoadFromStore() EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    bool WriteStore(bool fSync) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+
     void AddCachedTriggers(int active_height);
 
     void RequestOrphanObjects(CConnman& connman);
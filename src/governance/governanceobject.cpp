@@ -77,7 +77,9 @@ CGovernanceObject::CGovernanceObject(const CGovernanceObject& other) :
     fDirtyCache(other.fDirtyCache),
     fExpired(other.fExpired),
     fUnparsable(other.fUnparsable),
+    fDirtyStore(other.fDirtyStore),
     mapCurrentMNVotes(other.mapCurrentMNVotes),
+    voteTallies(other.voteTallies),
     fileVotes(other.fileVotes)
 {
 }
@@ -191,9 +193,12 @@ bool CGovernanceObject::ProcessVote(const CDeterministicMNList& tip_mn_list,
         return false;
     }
 
+    UpdateVoteTally(eSignal, voteInstanceRef.eOutcome, -1);
     voteInstanceRef = vote_instance_t(vote.GetOutcome(), nVoteTimeUpdate, vote.GetTimestamp());
+    UpdateVoteTally(eSignal, voteInstanceRef.eOutcome, 1);
     fileVotes.AddVote(vote);
     fDirtyCache = true;
+    fDirtyStore = true;
     // SEND NOTIFICATION TO SCRIPT/ZMQ
     GetMainSignals().NotifyGovernanceVote(vote.GetHash());
     return true;
@@ -206,9 +211,13 @@ void CGovernanceObject::ClearMasternodeVotes(const CDeterministicMNList& tip_mn_
     auto it = mapCurrentMNVotes.begin();
     while (it != mapCurrentMNVotes.end()) {
         if (!tip_mn_list.HasMNByCollateral(it->first)) {
+            for (const auto& [nSignal, voteInstance] : it->second.mapInstances) {
+                UpdateVoteTally(nSignal, voteInstance.eOutcome, -1);
+            }
             fileVotes.RemoveVotesFromMasternode(it->first);
             mapCurrentMNVotes.erase(it++);
             fDirtyCache = true;
+            fDirtyStore = true;
         } else {
             ++it;
         }
@@ -229,12 +238,14 @@ std::set<uint256> CGovernanceObject::RemoveInvalidVotes(const CDeterministicMNLi
     if (removedVotes.empty()) {
         return {};
     }
+    fDirtyStore = true;
 
     auto nParentHash = GetHash();
     for (auto jt = it->second.mapInstances.begin(); jt != it->second.mapInstances.end(); ) {
         CGovernanceVote tmpVote(mnOutpoint, nParentHash, (vote_signal_enum_t)jt->first, jt->second.eOutcome);
         tmpVote.SetTime(jt->second.nCreationTime);
         if (removedVotes.count(tmpVote.GetHash())) {
+            UpdateVoteTally(jt->first, jt->second.eOutcome, -1);
             jt = it->second.mapInstances.erase(jt);
         } else {
             ++jt;
@@ -563,19 +574,37 @@ bool CGovernanceObject::IsCollateralValid(ChainstateManager &chainman, std::stri
     return true;
 }
 
-int CGovernanceObject::CountMatchingVotes(vote_signal_enum_t eVoteSignalIn, vote_outcome_enum_t eVoteOutcomeIn) const
+void CGovernanceObject::UpdateVoteTally(int nSignal, vote_outcome_enum_t eOutcome, int nDelta)
+{
+    AssertLockHeld(cs);
+
+    // placeholder instances (VOTE_OUTCOME_NONE) and unsupported signals are never counted
+    if (nSignal <= VOTE_SIGNAL_NONE || nSignal > MAX_SUPPORTED_VOTE_SIGNAL || eOutcome <= VOTE_OUTCOME_NONE || eOutcome > VOTE_OUTCOME_ABSTAIN) {
+        return;
+    }
+    voteTallies[nSignal][eOutcome] += nDelta;
+}
+
+void CGovernanceObject::RebuildVoteTallies()
 {
     LOCK(cs);
 
-    int nCount = 0;
-    for (const auto& votepair : mapCurrentMNVotes) {
-        const vote_rec_t& recVote = votepair.second;
-        auto it2 = recVote.mapInstances.find(eVoteSignalIn);
-        if (it2 != recVote.mapInstances.end() && it2->second.eOutcome == eVoteOutcomeIn) {
-            ++nCount;
+    voteTallies = {};
+    for (const auto& [outpoint, voteRecord] : mapCurrentMNVotes) {
+        for (const auto& [nSignal, voteInstance] : voteRecord.mapInstances) {
+            UpdateVoteTally(nSignal, voteInstance.eOutcome, 1);
         }
     }
-    return nCount;
+}
+
+int CGovernanceObject::CountMatchingVotes(vote_signal_enum_t eVoteSignalIn, vote_outcome_enum_t eVoteOutcomeIn) const
+{
+    LOCK(cs);
+
+    if (eVoteSignalIn <= VOTE_SIGNAL_NONE || eVoteSignalIn > MAX_SUPPORTED_VOTE_SIGNAL || eVoteOutcomeIn <= VOTE_OUTCOME_NONE || eVoteOutcomeIn > VOTE_OUTCOME_ABSTAIN) {
+        return 0;
+    }
+    return voteTallies[eVoteSignalIn][eVoteOutcomeIn];
 }
 
 /**
@@ -619,6 +648,48 @@ bool CGovernanceObject::GetCurrentMNVotes(const COutPoint& mnCollateralOutpoint,
     return true;
 }
 
+std::vector<CGovernanceVote> CGovernanceObject::GetCurrentVotes(const CDeterministicMNList& tip_mn_list, const COutPoint& mnCollateralOutpointFilter) const
+{
+    LOCK(cs);
+
+    std::vector<CGovernanceVote> vecResult;
+    const uint256 nParentHash = GetHash();
+    const auto addVotes = [&](const COutPoint& outpoint, const vote_rec_t& voteRecord) {
+        if (!tip_mn_list.HasMNByCollateral(outpoint)) return;
+        for (const auto& [nSignal, voteInstance] : voteRecord.mapInstances) {
+            CGovernanceVote vote(outpoint, nParentHash, (vote_signal_enum_t)nSignal, voteInstance.eOutcome);
+            vote.SetTime(voteInstance.nCreationTime);
+            vecResult.push_back(vote);
+        }
+    };
+
+    if (!mnCollateralOutpointFilter.IsNull()) {
+        auto it = mapCurrentMNVotes.find(mnCollateralOutpointFilter);
+        if (it != mapCurrentMNVotes.end()) {
+            addVotes(it->first, it->second);
+        }
+        return vecResult;
+    }
+    for (const auto& [outpoint, voteRecord] : mapCurrentMNVotes) {
+        addVotes(outpoint, voteRecord);
+    }
+    return vecResult;
+}
+
+std::vector<COutPoint> CGovernanceObject::GetVotingMasternodes() const
+{
+    LOCK(cs);
+
+    std::vector<COutPoint> vecResult;
+    vecResult.reserve(mapCurrentMNVotes.size());
+    for (const auto& [outpoint, voteRecord] : mapCurrentMNVotes) {
+        if (!voteRecord.mapInstances.empty()) {
+            vecResult.emplace_back(outpoint);
+        }
+    }
+    return vecResult;
+}
+
 void CGovernanceObject::Relay(PeerManager& peerman) const
 {
     // Do not relay until fully synced
@@ -658,6 +729,7 @@ void CGovernanceObject::UpdateSentinelVariables(const CDeterministicMNList& tip_
         fCachedDelete = true;
         if (nDeletionTime == 0) {
             nDeletionTime = GetTime<std::chrono::seconds>().count();
+            fDirtyStore = true;
         }
     }
     if (GetAbsoluteYesCount(VOTE_SIGNAL_ENDORSED) >= nAbsVoteReq) fCachedEndorsed = true;
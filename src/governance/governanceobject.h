@@ -14,6 +14,8 @@
 #include <univalue.h>
 #include <kernel/cs_main.h>
 
+#include <array>
+
 class CActiveMasternodeManager;
 class CBLSPublicKey;
 class CDeterministicMNList;
@@ -135,8 +137,15 @@ private:
     /// Failed to parse object data
     bool fUnparsable;
 
+    /// SYSCOIN object (or its votes) changed since it was last written to the governance db
+    bool fDirtyStore{true};
+
     vote_m_t mapCurrentMNVotes;
 
+    // SYSCOIN running count of current votes per signal and outcome, kept in sync with mapCurrentMNVotes
+    using vote_tally_t = std::array<std::array<int, VOTE_OUTCOME_ABSTAIN + 1>, MAX_SUPPORTED_VOTE_SIGNAL + 1>;
+    vote_tally_t voteTallies{};
+
     CGovernanceObjectVoteFile fileVotes;
 
 public:
@@ -210,9 +219,20 @@ public:
 
     void SetExpired()
     {
+        if (!fExpired) fDirtyStore = true;
         fExpired = true;
     }
 
+    bool IsSetDirtyStore() const
+    {
+        return fDirtyStore;
+    }
+
+    void ClearDirtyStore()
+    {
+        fDirtyStore = false;
+    }
+
     const CGovernanceObjectVoteFile& GetVoteFile() const
     {
         return fileVotes;
@@ -244,6 +264,7 @@ public:
         fCachedDelete = true;
         if (nDeletionTime == 0) {
             nDeletionTime = nDeletionTime_;
+            fDirtyStore = true;
         }
     }
 
@@ -267,6 +288,10 @@ public:
     int GetAbstainCount(vote_signal_enum_t eVoteSignalIn) const;
 
     bool GetCurrentMNVotes(const COutPoint& mnCollateralOutpoint, vote_rec_t& voteRecord) const;
+    /// Current votes of all masternodes in tip_mn_list (or only of mnCollateralOutpointFilter if not null)
+    std::vector<CGovernanceVote> GetCurrentVotes(const CDeterministicMNList& tip_mn_list, const COutPoint& mnCollateralOutpointFilter) const;
+    /// Collaterals of all masternodes that currently have a vote on this object
+    std::vector<COutPoint> GetVotingMasternodes() const;
 
     // FUNCTIONS FOR DEALING WITH DATA STRING
 
@@ -282,6 +307,7 @@ public:
         if (s.GetType() & SER_DISK) {
             // Only include these for the disk file format
             READWRITE(obj.nDeletionTime, obj.fExpired, obj.mapCurrentMNVotes, obj.fileVotes);
+            SER_READ(obj, obj.RebuildVoteTallies());
         }
 
         // AFTER DESERIALIZATION OCCURS, CACHED VARIABLES MUST BE CALCULATED MANUALLY
@@ -304,6 +330,10 @@ public:
     // also for MNs that were removed from the list completely.
     // Returns deleted vote hashes.
     std::set<uint256> RemoveInvalidVotes(const CDeterministicMNList& tip_mn_list, const COutPoint& mnOutpoint);
+
+private:
+    void UpdateVoteTally(int nSignal, vote_outcome_enum_t eOutcome, int nDelta);
+    void RebuildVoteTallies();
 };
 
 
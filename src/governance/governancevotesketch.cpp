@@ -0,0 +1,56 @@
+// Copyright (c) 2026 The Syscoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <governance/governancevotesketch.h>
+
+#include <crypto/siphash.h>
+#include <node/minisketchwrapper.h>
+
+#include <algorithm>
+
+CGovernanceVoteSketch::CGovernanceVoteSketch(uint64_t _k0, uint64_t _k1, uint32_t _nCapacity, const std::vector<uint256>& voteHashes) :
+    k0(_k0),
+    k1(_k1),
+    nCapacity(std::clamp(_nCapacity, MIN_CAPACITY, MAX_CAPACITY))
+{
+    Minisketch sketch = node::MakeMinisketch32(nCapacity);
+    for (const auto& voteHash : voteHashes) {
+        sketch.Add(GetShortId(voteHash));
+    }
+    vchSketch = sketch.Serialize();
+}
+
+uint32_t CGovernanceVoteSketch::CapacityForVoteCount(size_t nKnownVotes)
+{
+    return std::clamp<uint32_t>(nKnownVotes / 8, MIN_CAPACITY, MAX_CAPACITY);
+}
+
+bool CGovernanceVoteSketch::IsValid() const
+{
+    return nCapacity >= MIN_CAPACITY && nCapacity <= MAX_CAPACITY && vchSketch.size() == size_t{nCapacity} * ELEMENT_SIZE;
+}
+
+uint32_t CGovernanceVoteSketch::GetShortId(const uint256& voteHash) const
+{
+    const uint32_t nShortId = SipHashUint256(k0, k1, voteHash);
+    // zero is not a valid sketch element
+    return nShortId == 0 ? 1 : nShortId;
+}
+
+std::optional<std::vector<uint32_t>> CGovernanceVoteSketch::Reconcile(const std::vector<uint256>& ourVoteHashes) const
+{
+    if (!IsValid()) return std::nullopt;
+
+    Minisketch theirs = node::MakeMinisketch32(nCapacity);
+    theirs.Deserialize(vchSketch);
+    Minisketch ours = node::MakeMinisketch32(nCapacity);
+    for (const auto& voteHash : ourVoteHashes) {
+        ours.Add(GetShortId(voteHash));
+    }
+    ours.Merge(theirs);
+
+    const auto difference = ours.Decode(nCapacity);
+    if (!difference) return std::nullopt;
+    return std::vector<uint32_t>(difference->begin(), difference->end());
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2026 The Syscoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SYSCOIN_GOVERNANCE_GOVERNANCEVOTESKETCH_H
+#define SYSCOIN_GOVERNANCE_GOVERNANCEVOTESKETCH_H
+
+#include <serialize.h>
+#include <uint256.h>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * Minisketch of the vote hashes a node knows for one governance object. Sent along with MNGOVERNANCESYNC
+ * (instead of a bloom filter) so that the serving peer only announces the votes in the symmetric
+ * difference of both sets, as long as that difference fits into the sketch capacity.
+ */
+class CGovernanceVoteSketch
+{
+public:
+    static constexpr uint32_t MIN_CAPACITY{32};
+    static constexpr uint32_t MAX_CAPACITY{512};
+    // each element of a 32 bit sketch takes 4 bytes
+    static constexpr uint32_t ELEMENT_SIZE{4};
+
+    uint64_t k0{0};
+    uint64_t k1{0};
+    uint32_t nCapacity{0};
+    std::vector<unsigned char> vchSketch;
+
+    CGovernanceVoteSketch() = default;
+    CGovernanceVoteSketch(uint64_t _k0, uint64_t _k1, uint32_t _nCapacity, const std::vector<uint256>& voteHashes);
+
+    /// Capacity a node with nKnownVotes votes asks for, it expects to be missing only a fraction of them
+    static uint32_t CapacityForVoteCount(size_t nKnownVotes);
+
+    bool IsValid() const;
+    uint32_t GetShortId(const uint256& voteHash) const;
+
+    /// Short ids of the votes that are in only one of both sets, nullopt if the difference doesn't fit
+    std::optional<std::vector<uint32_t>> Reconcile(const std::vector<uint256>& ourVoteHashes) const;
+
+    SERIALIZE_METHODS(CGovernanceVoteSketch, obj)
+    {
+        READWRITE(obj.k0, obj.k1, obj.nCapacity, obj.vchSketch);
+    }
+};
+
+#endif // SYSCOIN_GOVERNANCE_GOVERNANCEVOTESKETCH_H
@@ -640,6 +640,7 @@ void SetupServerArgs(ArgsManager& argsman)
     argsman.AddArg("-btcheadertipmaxnoprogress=<n>", strprintf("Maximum seconds without BTC tip-height progress before BTCC signing pauses (0 disables, default: %d)", DEFAULT_BTC_HEADER_TIP_MAX_NO_PROGRESS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-btcheadermaxlagblocks=<n>", strprintf("Maximum allowed lag (in BTC blocks) between active tip and candidate BTCPREV before BTCC signing pauses (0 disables, default: %d)", DEFAULT_BTC_HEADER_MAX_LAG_BLOCKS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-btcheaderrecentforkdepth=<n>", strprintf("Pause BTCC signing when a non-active BTC chain tip exists within this many blocks of the active tip (0 disables, default: %d)", DEFAULT_BTC_HEADER_RECENT_FORK_DEPTH), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-evodbdiffs", strprintf("Store masternode lists as per-block diffs between full lists every %d blocks, older versions need -reindex to read the database afterwards (default: %u)", CDeterministicMNManager::DISK_SNAPSHOT_PERIOD, DEFAULT_EVODB_DIFFS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-llmqtestparams=<n:m>", "LLMQ params used for testing only", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-mncollateral=<n>", strprintf("Masternode Collateral required, used for testing only (default: %u)", DEFAULT_MN_COLLATERAL_REQUIRED), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-sporkkey=<key>", strprintf("Private key for use with sporks"), ArgsManager::ALLOW_ANY | ArgsManager::SENSITIVE, OptionsCategory::OPTIONS);
@@ -724,6 +725,7 @@ void SetupServerArgs(ArgsManager& argsman)
     argsman.AddArg("-zmqpubrawtxhwm=<n>", strprintf("Set publish raw transaction outbound message high water mark (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     // SYSCOIN
     argsman.AddArg("-zmqpubnevm=<address>", "Enable NEVM publishing/subscriber for Geth node in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqpubnevmpipeline=<n>", strprintf("Keep up to <n> NEVM block connect requests in flight to Geth for blocks under -assumevalid, 0 to wait for every response (0-%d, default: %d)", MAX_ZMQ_NEVM_PIPELINE_DEPTH, DEFAULT_ZMQ_NEVM_PIPELINE_DEPTH), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubhashgovernancevote=<address>", "Enable publish hash of governance votes transaction in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubhashgovernanceobject=<address>", "Enable publish hash of governance objects transaction in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubrawgovernancevote=<address>", "Enable publish raw governance votes transaction in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
@@ -750,6 +752,7 @@ void SetupServerArgs(ArgsManager& argsman)
     hidden_args.emplace_back("-zmqpubrawtxhwm=<n>");
     hidden_args.emplace_back("-zmqpubsequencehwm=<n>");
     hidden_args.emplace_back("-zmqpubnevm=<address>");
+    hidden_args.emplace_back("-zmqpubnevmpipeline=<n>");
 #endif
 
     argsman.AddArg("-checkblocks=<n>", strprintf("How many blocks to check at startup (default: %u, 0 = all)", DEFAULT_CHECKBLOCKS), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
@@ -1354,6 +1357,13 @@ bool AppInitMain(NodeContext& node, interfaces::BlockAndHeaderTipInfo* tip_info)
     {
         return InitError(strprintf(_("Unable to allocate memory for -maxsigcachesize: '%s' MiB"), args.GetIntArg("-maxsigcachesize", DEFAULT_MAX_SIG_CACHE_BYTES >> 20)));
     }
+    // SYSCOIN
+    if (!InitMintProofCache(DEFAULT_MAX_MINT_PROOF_CACHE_BYTES)) {
+        return InitError(_("Unable to allocate memory for the mint proof cache"));
+    }
+    if (!InitAuxPowCache(DEFAULT_MAX_AUXPOW_CACHE_BYTES)) {
+        return InitError(_("Unable to allocate memory for the auxpow cache"));
+    }
 
     int script_threads = args.GetIntArg("-par", DEFAULT_SCRIPTCHECK_THREADS);
     if (script_threads <= 0) {
@@ -1688,6 +1698,7 @@ bool AppInitMain(NodeContext& node, interfaces::BlockAndHeaderTipInfo* tip_info)
     // SYSCOIN
     fNEVMSub = gArgs.GetArg("-zmqpubnevm", GetDefaultPubNEVM());
     fNEVMConnection = !fNEVMSub.empty();
+    nNEVMPipelineDepth = std::clamp<int>(gArgs.GetIntArg("-zmqpubnevmpipeline", DEFAULT_ZMQ_NEVM_PIPELINE_DEPTH), 0, MAX_ZMQ_NEVM_PIPELINE_DEPTH);
     g_zmq_notification_interface = CZMQNotificationInterface::Create(
         [&chainman = node.chainman](CBlock& block, const CBlockIndex& index) {
             assert(chainman);
@@ -1807,6 +1818,7 @@ bool AppInitMain(NodeContext& node, interfaces::BlockAndHeaderTipInfo* tip_info)
         // SYSCOIN
         node::ChainstateLoadOptions options;
         options.fReindexGeth = fReindexGeth;
+        options.evodb_diffs = args.GetBoolArg("-evodbdiffs", DEFAULT_EVODB_DIFFS);
         options.connman = Assert(node.connman.get());
         options.banman = Assert(node.banman.get());
         options.peerman = Assert(node.peerman.get());
@@ -5,6 +5,7 @@
 #include <kernel/context.h>
 
 #include <crypto/sha256.h>
+#include <crypto/sha3.h>
 #include <key.h>
 #include <logging.h>
 #include <pubkey.h>
@@ -22,6 +23,9 @@ Context::Context()
     g_context = this;
     std::string sha256_algo = SHA256AutoDetect();
     LogPrintf("Using the '%s' SHA256 implementation\n", sha256_algo);
+    // SYSCOIN
+    std::string keccak_algo = KeccakAutoDetect();
+    LogPrintf("Using the '%s' Keccak implementation\n", keccak_algo);
     RandomInit();
     ECC_Start();
     // SYSCOIN
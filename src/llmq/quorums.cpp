@@ -149,6 +149,9 @@ CQuorumManager::CQuorumManager(const DBParams& db_params_vvecs, const DBParams&
     evoDb_vvec(std::make_unique<CEvoDB<uint256, std::vector<CBLSPublicKey>, StaticSaltedHasher>>(db_params_vvecs, QUORUM_CACHE_SIZE)),
     evoDb_sk(std::make_unique<CEvoDB<uint256, CBLSSecretKey, StaticSaltedHasher>>(db_params_sk, QUORUM_CACHE_SIZE))
 {
+    DBParams db_params_data{db_params_vvecs};
+    db_params_data.path = db_params_vvecs.path.parent_path() / "evodb_qdata";
+    evoDb_data = std::make_unique<CEvoDB<uint256, CQuorumDataCache, StaticSaltedHasher>>(db_params_data, QUORUM_DATA_CACHE_SIZE);
     quorumThreadInterrupt.reset();
     vecQuorumsCache.reserve(QUORUM_CACHE_SIZE);
 }
@@ -229,6 +232,9 @@ CQuorumPtr CQuorumManager::BuildQuorumFromCommitment(
         } else {
             LogPrint(BCLog::LLMQ, "CQuorumManager::%s -- quorum.ReadContributions and BuildQuorumContributions for quorumHash[%s] failed\n", __func__, quorum->qc->quorumHash.ToString());
         }
+    } else {
+        // SYSCOIN the vvec is the one the shares were recovered from, so the shares of a previous run are still valid
+        quorum->fPubKeySharesLoaded = ReadPubKeyShares(*quorum);
     }
 
     return quorum;
@@ -415,9 +421,71 @@ CQuorumCPtr CQuorumManager::GetQuorum(const CBlockIndex* pQuorumBaseBlockIndex)
     return quorum;
 }
 
+bool CQuorumManager::ReadQuorumMembers(const uint256& quorumHash, std::vector<CDeterministicMNCPtr>& members) const
+{
+    CQuorumDataCache data;
+    if (!WITH_LOCK(cs_db, return evoDb_data->ReadCache(quorumHash, data)) || data.members.empty()) {
+        return false;
+    }
+    members = std::move(data.members);
+    return true;
+}
+
+void CQuorumManager::WriteQuorumMembers(const CBlockIndex* pQuorumBaseBlockIndex, const std::vector<CDeterministicMNCPtr>& members) const
+{
+    // an empty result usually means the list was not available, don't let it outlive this run
+    if (members.empty()) {
+        return;
+    }
+    const auto& llmqParams = Params().GetConsensus().llmqTypeChainLocks;
+    const uint256 quorumHash = pQuorumBaseBlockIndex->GetBlockHash();
+    LOCK(cs_db);
+    CQuorumDataCache data;
+    evoDb_data->ReadCache(quorumHash, data);
+    data.members = members;
+    evoDb_data->WriteCache(quorumHash, std::move(data));
+    // members of older quorums are not needed anymore after a restart
+    const int nPruneHeight = pQuorumBaseBlockIndex->nHeight - QUORUM_DATA_CACHE_SIZE * llmqParams.dkgInterval;
+    if (nPruneHeight >= 0) {
+        if (const CBlockIndex* pindexPrune = pQuorumBaseBlockIndex->GetAncestor(nPruneHeight)) {
+            evoDb_data->EraseCache(pindexPrune->GetBlockHash());
+        }
+    }
+}
+
+bool CQuorumManager::ReadPubKeyShares(CQuorum& quorum) const
+{
+    CQuorumDataCache data;
+    if (!WITH_LOCK(cs_db, return evoDb_data->ReadCache(quorum.qc->quorumHash, data))) {
+        return false;
+    }
+    if (data.pubKeySharesQuorumKey != MakeQuorumKey(quorum) || data.pubKeyShares.size() != quorum.members.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < quorum.members.size(); i++) {
+        if (quorum.qc->validMembers[i]) {
+            quorum.blsCache.SetPubKeyShare(quorum.members[i]->proTxHash, data.pubKeyShares[i]);
+        }
+    }
+    LogPrint(BCLog::LLMQ, "CQuorumManager::%s -- loaded %d public key shares for quorumHash[%s]\n", __func__, data.pubKeyShares.size(), quorum.qc->quorumHash.ToString());
+    return true;
+}
+
+void CQuorumManager::WritePubKeyShares(const CQuorum& quorum, std::vector<CBLSPublicKey>&& pubKeyShares) const
+{
+    LOCK(cs_db);
+    CQuorumDataCache data;
+    if (!evoDb_data->ReadCache(quorum.qc->quorumHash, data)) {
+        data.members = quorum.members;
+    }
+    data.pubKeySharesQuorumKey = MakeQuorumKey(quorum);
+    data.pubKeyShares = std::move(pubKeyShares);
+    evoDb_data->WriteCache(quorum.qc->quorumHash, std::move(data));
+}
+
 void CQuorumManager::StartCachePopulatorThread(const CQuorumCPtr pQuorum) const
 {
-    if (!pQuorum->HasVerificationVector()) {
+    if (!pQuorum->HasVerificationVector() || pQuorum->fPubKeySharesLoaded) {
         return;
     }
 
@@ -426,14 +494,17 @@ void CQuorumManager::StartCachePopulatorThread(const CQuorumCPtr pQuorum) const
 
     // when then later some other thread tries to get keys, it will be much faster
     workerPool.push([pQuorum, t, this](int threadId) {
+        std::vector<CBLSPublicKey> pubKeyShares(pQuorum->members.size());
         for (size_t i = 0; i < pQuorum->members.size(); i++) {
             if (quorumThreadInterrupt) {
-                break;
+                return;
             }
             if (pQuorum->qc->validMembers[i]) {
-                pQuorum->GetPubKeyShare(i);
+                pubKeyShares[i] = pQuorum->GetPubKeyShare(i);
             }
         }
+        // keep them for the next start, recovering all shares takes minutes for large quorums
+        WritePubKeyShares(*pQuorum, std::move(pubKeyShares));
         LogPrint(BCLog::LLMQ, "CQuorumManager::StartCachePopulatorThread -- done. time=%d\n", t.count());
     });
 }
@@ -465,6 +536,19 @@ bool CQuorumManager::DoMaintenance(bool bForceFlush, bool fSync) {
             }
         }
     }
+    {
+        LOCK(evoDb_data->cs);
+        if (evoDb_data->IsCacheFull()) {
+            evoDb_data->ResetDB();
+            bForceFlush = true;
+            LogPrint(BCLog::SYS, "CQuorumManager::DoMaintenance evoDb_data Database successfully wiped and recreated.\n");
+        }
+        if(bForceFlush) {
+            if(!evoDb_data->FlushCacheToDisk(/*CHUNK_ITEMS=*/16, fSync)) {
+                return false;
+            }
+        }
+    }
     return true;
 }
 bool CQuorumManager::FlushCacheToDisk(bool bForceFlush, bool fSync) {
@@ -54,6 +54,24 @@ using CQuorumCPtr = std::shared_ptr<const CQuorum>;
 class CFinalCommitment;
 using CFinalCommitmentPtr = std::unique_ptr<CFinalCommitment>;
 
+/**
+ * Quorum data which is expensive to derive again after a restart, stored per quorum hash: the members calculated
+ * from the masternode list of the quorum base block and the public key shares recovered from the quorum vvec.
+ */
+class CQuorumDataCache
+{
+public:
+    std::vector<CDeterministicMNCPtr> members;
+    // the shares belong to one specific commitment, see CQuorumManager::MakeQuorumKey
+    uint256 pubKeySharesQuorumKey;
+    std::vector<CBLSPublicKey> pubKeyShares;
+
+    SERIALIZE_METHODS(CQuorumDataCache, obj)
+    {
+        READWRITE(obj.members, obj.pubKeySharesQuorumKey, obj.pubKeyShares);
+    }
+};
+
 
 class CQuorum
 {
@@ -73,6 +91,8 @@ private:
     // These are only valid when we either participated in the DKG or fully watched it
     BLSVerificationVectorPtr quorumVvec GUARDED_BY(cs_vvec_shShare);
     CBLSSecretKey skShare GUARDED_BY(cs_vvec_shShare);
+    // set before the quorum is published when the public key shares were loaded from CQuorumDataCache
+    bool fPubKeySharesLoaded{false};
 
 public:
     CQuorum(CBLSWorker& _blsWorker);
@@ -116,10 +136,13 @@ private:
     mutable ctpl::thread_pool workerPool;
     mutable CThreadInterrupt quorumThreadInterrupt;
     static constexpr int QUORUM_CACHE_SIZE = 10;
+    // number of DKG intervals CQuorumDataCache entries are kept for
+    static constexpr int QUORUM_DATA_CACHE_SIZE = 16;
 
 public:
     std::unique_ptr<CEvoDB<uint256, std::vector<CBLSPublicKey>, StaticSaltedHasher>> evoDb_vvec;
     std::unique_ptr<CEvoDB<uint256, CBLSSecretKey, StaticSaltedHasher>> evoDb_sk;
+    std::unique_ptr<CEvoDB<uint256, CQuorumDataCache, StaticSaltedHasher>> evoDb_data;
     explicit CQuorumManager(const DBParams& db_params_vvecs, const DBParams& db_params_sk, CBLSWorker& _blsWorker, CDKGSessionManager& _dkgManager, ChainstateManager& _chainman);
     ~CQuorumManager();
 
@@ -138,6 +161,9 @@ public:
     // this one is cs_main-free
     std::vector<CQuorumCPtr> ScanQuorums(const CBlockIndex* pindexStart, size_t nCountRequested) EXCLUSIVE_LOCKS_REQUIRED(!cs_quorums, !cs_db);
     bool FlushCacheToDisk(bool bForceFlush, bool fSync = true);
+
+    bool ReadQuorumMembers(const uint256& quorumHash, std::vector<CDeterministicMNCPtr>& members) const EXCLUSIVE_LOCKS_REQUIRED(!cs_db);
+    void WriteQuorumMembers(const CBlockIndex* pQuorumBaseBlockIndex, const std::vector<CDeterministicMNCPtr>& members) const EXCLUSIVE_LOCKS_REQUIRED(!cs_db);
 private:
     static uint256 MakeQuorumKey(const CQuorum& quorum);
     static bool IsQuorumMinedOnChain(
@@ -157,7 +183,9 @@ private:
     bool BuildQuorumContributions(const CFinalCommitmentPtr& fqc, const std::shared_ptr<CQuorum>& quorum) const EXCLUSIVE_LOCKS_REQUIRED(!cs_db, !cs_quorums);
 
     CQuorumCPtr GetQuorum(const CBlockIndex* pindex) EXCLUSIVE_LOCKS_REQUIRED(!cs_quorums, !cs_db);
-    void StartCachePopulatorThread(const CQuorumCPtr pQuorum) const;
+    void StartCachePopulatorThread(const CQuorumCPtr pQuorum) const EXCLUSIVE_LOCKS_REQUIRED(!cs_db);
+    bool ReadPubKeyShares(CQuorum& quorum) const EXCLUSIVE_LOCKS_REQUIRED(!cs_db);
+    void WritePubKeyShares(const CQuorum& quorum, std::vector<CBLSPublicKey>&& pubKeyShares) const EXCLUSIVE_LOCKS_REQUIRED(!cs_db);
 
     friend class CQuorum;
     friend class llmq_tests::CQuorumManagerTestAccess;
@@ -0,0 +1,77 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <llmq/quorums_aggsigcache.h>
+
+#include <chain.h>
+#include <hash.h>
+#include <llmq/quorums.h>
+#include <llmq/quorums_commitment.h>
+#include <logging.h>
+
+namespace llmq
+{
+
+CAggregatedSigCache* aggregatedSigCache;
+
+uint256 BuildQuorumSetFingerprint(const std::vector<CQuorumCPtr>& quorums)
+{
+    CHashWriter fingerprint_writer(SER_NETWORK, 0);
+    fingerprint_writer << static_cast<uint64_t>(quorums.size());
+    for (const auto& quorum : quorums) {
+        if (quorum == nullptr || quorum->m_quorum_base_block_index == nullptr) {
+            return uint256();
+        }
+        fingerprint_writer
+            << quorum->m_quorum_base_block_index->GetBlockHash()
+            << quorum->minedBlockHash
+            << ::SerializeHash(*quorum->qc);
+    }
+    return fingerprint_writer.GetHash();
+}
+
+std::optional<bool> CAggregatedSigCache::Get(const uint256& hash, const uint256& quorumSetFingerprint)
+{
+    std::pair<uint256, bool> entry;
+    LOCK(cs);
+    if (!results.get(hash, entry) || entry.first != quorumSetFingerprint) {
+        return std::nullopt;
+    }
+    return entry.second;
+}
+
+void CAggregatedSigCache::Add(const uint256& hash, const uint256& quorumSetFingerprint, bool valid)
+{
+    if (quorumSetFingerprint.IsNull()) {
+        return;
+    }
+    LOCK(cs);
+    results.insert(hash, std::make_pair(quorumSetFingerprint, valid));
+}
+
+void CAggregatedSigCache::UpdatedBlockTip(const CBlockIndex* pindexNew)
+{
+    if (pindexNew == nullptr || quorumManager == nullptr) {
+        return;
+    }
+    const auto quorums = quorumManager->ScanQuorums(pindexNew, 1);
+    const uint256 quorumHash = quorums.empty() ? uint256() : quorums.front()->qc->quorumHash;
+
+    LOCK(cs);
+    if (quorumHash == newestQuorumHash) {
+        return;
+    }
+    LogPrint(BCLog::CHAINLOCKS, "CAggregatedSigCache::%s -- newest quorum changed to %s at height %d, clearing results\n",
+             __func__, quorumHash.ToString(), pindexNew->nHeight);
+    newestQuorumHash = quorumHash;
+    results.clear();
+}
+
+void CAggregatedSigCache::Clear()
+{
+    LOCK(cs);
+    results.clear();
+}
+
+} // namespace llmq
@@ -0,0 +1,58 @@
+// Copyright (c) 2024 The Syscoin Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef SYSCOIN_LLMQ_QUORUMS_AGGSIGCACHE_H
+#define SYSCOIN_LLMQ_QUORUMS_AGGSIGCACHE_H
+
+#include <saltedhasher.h>
+#include <sync.h>
+#include <uint256.h>
+#include <unordered_lru_cache.h>
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+class CBlockIndex;
+
+namespace llmq
+{
+
+class CQuorum;
+using CQuorumCPtr = std::shared_ptr<const CQuorum>;
+
+// Identifies an ordered set of signing quorums by base block, mined block and commitment. Signatures aggregated
+// over sets with the same fingerprint verify against the same public keys at the same signer positions.
+// Returns a null hash if any quorum in the set is incomplete.
+uint256 BuildQuorumSetFingerprint(const std::vector<CQuorumCPtr>& quorums);
+
+// Outcome of aggregated CLSIG and BTC checkpoint signature verification, shared by both handlers.
+// An aggregated signature is usually relayed by many peers and checked again when the block is connected, while each
+// verification costs one pairing per signing quorum. Results are keyed by the hash of the signed object and only
+// reused for the quorum set they were computed against, invalid results included, so the same bad aggregate is
+// not paired again for every peer relaying it. All results are dropped when a new signing quorum becomes active.
+class CAggregatedSigCache
+{
+public:
+    static constexpr size_t MAX_ENTRIES{2048};
+
+private:
+    mutable Mutex cs;
+    unordered_lru_cache<uint256, std::pair<uint256, bool>, StaticSaltedHasher, MAX_ENTRIES> results GUARDED_BY(cs);
+    uint256 newestQuorumHash GUARDED_BY(cs);
+
+public:
+    std::optional<bool> Get(const uint256& hash, const uint256& quorumSetFingerprint) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    void Add(const uint256& hash, const uint256& quorumSetFingerprint, bool valid) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+
+    void UpdatedBlockTip(const CBlockIndex* pindexNew) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    void Clear() EXCLUSIVE_LOCKS_REQUIRED(!cs);
+};
+
+extern CAggregatedSigCache* aggregatedSigCache;
+
+} // namespace llmq
+
+#endif // SYSCOIN_LLMQ_QUORUMS_AGGSIGCACHE_H
@@ -5,6 +5,7 @@
 #include <llmq/quorums_btccheckpoints.h>
 
 #include <llmq/quorums.h>
+#include <llmq/quorums_aggsigcache.h>
 #include <llmq/quorums_commitment.h>
 #include <llmq/quorums_utils.h>
 #include <chain.h>
@@ -724,6 +725,7 @@ void CBTCCheckpointsHandler::Cleanup()
                 ++it;
             }
         }
+        PublishBestBTCCheckpoint();
     }
 
     lastCleanupTime = TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now());
@@ -1084,6 +1086,7 @@ void CBTCCheckpointsHandler::TrySignBTCCheckpointTip()
                 ++it;
             }
         }
+        PublishBestBTCCheckpoint();
     }
 
     CBTCCheckpointSig want;
@@ -1266,6 +1269,7 @@ void CBTCCheckpointsHandler::AddRecentBTCCheckpoint(const CBTCCheckpointSig& btc
         // prune lowest height entry (map is ascending by height)
         recentBTCCheckpoints.erase(recentBTCCheckpoints.begin());
     }
+    PublishBestBTCCheckpoint();
 }
 
 void CBTCCheckpointsHandler::AddPendingVerifiedBTCCheckpointSig(const uint256& hash, const CBTCCheckpointSig& btccsig)
@@ -1549,24 +1553,31 @@ void CBTCCheckpointsHandler::HandleNewRecoveredSig(const CRecoveredSig& recovere
 
 CBTCCheckpointSig CBTCCheckpointsHandler::GetMostRecentBTCCheckpoint() const
 {
-    LOCK(cs);
-    if (recentBTCCheckpoints.empty()) {
-        return CBTCCheckpointSig();
-    }
-    return recentBTCCheckpoints.rbegin()->second;
+    return GetBestBTCCheckpointSnapshot()->mostRecent;
 }
 
 CBTCCheckpointSig CBTCCheckpointsHandler::GetBestBTCCheckpoint() const
 {
-    LOCK(cs);
-    if (bestCandidates.empty()) {
-        return CBTCCheckpointSig();
+    return GetBestBTCCheckpointSnapshot()->best;
+}
+
+void CBTCCheckpointsHandler::PublishBestBTCCheckpoint()
+{
+    auto snapshot = std::make_shared<BestBTCCheckpointSnapshot>();
+    if (!bestCandidates.empty() && bestCandidates.rbegin()->second) {
+        snapshot->best = *bestCandidates.rbegin()->second;
     }
-    auto it = bestCandidates.rbegin();
-    if (!it->second) {
-        return CBTCCheckpointSig();
+    if (!recentBTCCheckpoints.empty()) {
+        snapshot->mostRecent = recentBTCCheckpoints.rbegin()->second;
     }
-    return *it->second;
+    LOCK(cs_snapshot);
+    bestSnapshot = std::move(snapshot);
+}
+
+CBTCCheckpointsHandler::BestBTCCheckpointSnapshotPtr CBTCCheckpointsHandler::GetBestBTCCheckpointSnapshot() const
+{
+    LOCK(cs_snapshot);
+    return bestSnapshot;
 }
 
 std::map<CQuorumCPtr, CBTCCheckpointSigCPtr> CBTCCheckpointsHandler::GetBestBTCCheckpointShares() const
@@ -1612,7 +1623,22 @@ bool CBTCCheckpointsHandler::VerifyAggregatedBTCCheckpoint(const CBTCCheckpointS
             return true;
         }
     }
-    const bool ok = VerifyAggregatedBTCCheckpointNoCache(btcsig, pindexScan, retSigVerifyAttempted);
+    const auto& llmqParams = Params().GetConsensus().llmqTypeChainLocks;
+    const uint256 fingerprint = BuildQuorumSetFingerprint(llmq::quorumManager->ScanQuorums(pindexScan, llmqParams.signingActiveQuorumCount));
+    if (const auto cached = aggregatedSigCache->Get(hash, fingerprint)) {
+        if (retSigVerifyAttempted) {
+            *retSigVerifyAttempted = true;
+        }
+        return *cached;
+    }
+    bool sig_verify_attempted{false};
+    const bool ok = VerifyAggregatedBTCCheckpointNoCache(btcsig, pindexScan, &sig_verify_attempted);
+    if (retSigVerifyAttempted) {
+        *retSigVerifyAttempted = sig_verify_attempted;
+    }
+    if (sig_verify_attempted) {
+        aggregatedSigCache->Add(hash, fingerprint, ok);
+    }
     if (ok) {
         LOCK(cs);
         sigChecked.emplace(hash, TicksSinceEpoch<std::chrono::milliseconds>(SystemClock::now()));
@@ -140,6 +140,17 @@ private:
     // once the local expected height reaches the object's height. Keyed by object hash.
     std::map<uint256, std::pair<CBTCCheckpointSig, int64_t>> pendingVerifiedBTCCheckpointSigs GUARDED_BY(cs);
 
+    // Immutable copy of the best and most recent checkpoint, republished under cs whenever bestCandidates or
+    // recentBTCCheckpoints change, so hot readers don't contend on cs. cs_snapshot only guards the pointer swap.
+    struct BestBTCCheckpointSnapshot
+    {
+        CBTCCheckpointSig best;
+        CBTCCheckpointSig mostRecent;
+    };
+    using BestBTCCheckpointSnapshotPtr = std::shared_ptr<const BestBTCCheckpointSnapshot>;
+    mutable Mutex cs_snapshot;
+    BestBTCCheckpointSnapshotPtr bestSnapshot GUARDED_BY(cs_snapshot) {std::make_shared<const BestBTCCheckpointSnapshot>()};
+
 public:
     CBTCCheckpointsHandler(CConnman& connman, PeerManager& peerman, ChainstateManager& chainman);
 
@@ -157,8 +168,8 @@ public:
 
     void HandleNewRecoveredSig(const CRecoveredSig& recoveredSig) override EXCLUSIVE_LOCKS_REQUIRED(!cs);
 
-    CBTCCheckpointSig GetMostRecentBTCCheckpoint() const EXCLUSIVE_LOCKS_REQUIRED(!cs);
-    CBTCCheckpointSig GetBestBTCCheckpoint() const EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    CBTCCheckpointSig GetMostRecentBTCCheckpoint() const EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
+    CBTCCheckpointSig GetBestBTCCheckpoint() const EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
     std::map<CQuorumCPtr, CBTCCheckpointSigCPtr> GetBestBTCCheckpointShares() const EXCLUSIVE_LOCKS_REQUIRED(!cs);
 
     bool GetRecentBTCCheckpointByHeight(int32_t nHeight, CBTCCheckpointSig& ret) const EXCLUSIVE_LOCKS_REQUIRED(!cs);
@@ -167,7 +178,9 @@ public:
     bool VerifyAggregatedBTCCheckpoint(const CBTCCheckpointSig& btcsig, const CBlockIndex* pindexScan, bool* retSigVerifyAttempted = nullptr) const EXCLUSIVE_LOCKS_REQUIRED(!cs);
 
 private:
-    void AddRecentBTCCheckpoint(const CBTCCheckpointSig& btcsig) EXCLUSIVE_LOCKS_REQUIRED(cs);
+    void AddRecentBTCCheckpoint(const CBTCCheckpointSig& btcsig) EXCLUSIVE_LOCKS_REQUIRED(cs, !cs_snapshot);
+    void PublishBestBTCCheckpoint() EXCLUSIVE_LOCKS_REQUIRED(cs, !cs_snapshot);
+    BestBTCCheckpointSnapshotPtr GetBestBTCCheckpointSnapshot() const EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
     bool TryUpdateBestBTCCheckpoint(const CBlockIndex* pindexScan) EXCLUSIVE_LOCKS_REQUIRED(cs);
     bool VerifyBTCCheckpointShare(const CBTCCheckpointSig& btcsig, const CBlockIndex* pindexScan, const uint256& idIn, std::pair<int, CQuorumCPtr>& ret, const uint256& hash, bool* retSigVerifyAttempted = nullptr) const EXCLUSIVE_LOCKS_REQUIRED(!cs);
     bool VerifyAggregatedBTCCheckpointNoCache(const CBTCCheckpointSig& btcsig, const CBlockIndex* pindexScan, bool* retSigVerifyAttempted = nullptr) const EXCLUSIVE_LOCKS_REQUIRED(!cs);
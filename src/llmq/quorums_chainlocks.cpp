@@ -3,6 +3,7 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <llmq/quorums_chainlocks.h>
+#include <llmq/quorums_aggsigcache.h>
 #include <llmq/quorums_btccheckpoints.h>
 #include <llmq/quorums.h>
 #include <llmq/quorums_utils.h>
@@ -208,14 +209,26 @@ CChainLockSig CChainLocksHandler::GetMostRecentChainLock()
 }
 CChainLockSig CChainLocksHandler::GetBestChainLock()
 {
-    LOCK(cs);
-    return bestChainLockWithKnownBlock;
+    return GetBestChainLockSnapshot()->clsig;
 }
 
 const CBlockIndex* CChainLocksHandler::GetBestChainLockIndex()
 {
-    LOCK(cs);
-    return bestChainLockBlockIndex;
+    return GetBestChainLockSnapshot()->pindex;
+}
+
+void CChainLocksHandler::PublishBestChainLock()
+{
+    auto snapshot = std::make_shared<const BestChainLockSnapshot>(
+        BestChainLockSnapshot{bestChainLockWithKnownBlock, bestChainLockBlockIndex, isEnforced});
+    LOCK(cs_snapshot);
+    bestSnapshot = std::move(snapshot);
+}
+
+CChainLocksHandler::BestChainLockSnapshotPtr CChainLocksHandler::GetBestChainLockSnapshot() const
+{
+    LOCK(cs_snapshot);
+    return bestSnapshot;
 }
 std::map<CQuorumCPtr, CChainLockSigCPtr> CChainLocksHandler::GetBestChainLockShares()
 {
@@ -336,19 +349,8 @@ bool CChainLocksHandler::BuildQuorumContext(
         }
     }
 
-    CHashWriter fingerprint_writer(SER_NETWORK, 0);
-    fingerprint_writer << static_cast<uint64_t>(context.quorums.size());
-    for (const auto& quorum : context.quorums) {
-        if (quorum == nullptr || quorum->m_quorum_base_block_index == nullptr) {
-            return false;
-        }
-        fingerprint_writer
-            << quorum->m_quorum_base_block_index->GetBlockHash()
-            << quorum->minedBlockHash
-            << ::SerializeHash(*quorum->qc);
-    }
-    context.fingerprint = fingerprint_writer.GetHash();
-    return true;
+    context.fingerprint = BuildQuorumSetFingerprint(context.quorums);
+    return !context.fingerprint.IsNull();
 }
 
 bool CChainLocksHandler::TryUpdateBestChainLock(
@@ -368,6 +370,7 @@ bool CChainLocksHandler::TryUpdateBestChainLock(
         }
         bestChainLockWithKnownBlock = *it1->second;
         bestChainLockBlockIndex = pindex;
+        PublishBestChainLock();
         AddRecentChainLock(bestChainLockWithKnownBlock);
         // only prune blob data upon chainlock so we cannot rollback on pruned blob transactions. If we rolled back on pruned blob data then upon new inclusion there could be situation
         // where new block would fall within 2-hour time window of enforcement and include the pruned blob tx
@@ -417,6 +420,7 @@ bool CChainLocksHandler::TryUpdateBestChainLock(
             bestChainLockBlockIndex = pindex;
             bestChainLockCandidates[clsigAgg.nHeight] =
                 std::make_shared<const CChainLockSig>(clsigAgg);
+            PublishBestChainLock();
             AddRecentChainLock(bestChainLockWithKnownBlock);
             // only prune blob data upon chainlock so we cannot rollback on pruned blob transactions. If we rolled back on pruned blob data then upon new inclusion there could be situation
             // where new block would fall within 2-hour time window of enforcement and include the pruned blob tx
@@ -680,7 +684,12 @@ bool CChainLocksHandler::VerifyAggregatedChainLock(
     if (retSigVerifyAttempted) {
         *retSigVerifyAttempted = true;
     }
+    if (const auto cached = aggregatedSigCache->Get(hash, context.fingerprint)) {
+        LogPrint(BCLog::CHAINLOCKS, "CChainLocksHandler::%s -- CLSIG (%s) result %d from aggregated sig cache\n", __func__, clsig.ToString(), *cached);
+        return *cached;
+    }
     bool result = clsig.sig.VerifyInsecureAggregated(quorumPublicKeys, hashes);
+    aggregatedSigCache->Add(hash, context.fingerprint, result);
     if(result) {
         LOCK(cs);
         sigChecked.emplace(
@@ -1147,6 +1156,7 @@ void CChainLocksHandler::UpdatedBlockTip(const CBlockIndex* pindexNew, bool fIni
 {
     if(fInitialDownload)
         return;
+    aggregatedSigCache->UpdatedBlockTip(pindexNew);
     // BTCC signing must see every tip transition. Unlike ChainLocks, a coalesced scheduler run
     // can skip past BTCC sign windows during fast block production.
     if (btcCheckpointsHandler) {
@@ -1198,6 +1208,9 @@ void CChainLocksHandler::CheckActiveState()
             bestChainLockCandidates.clear();
             bestChainLockShares.clear();
         }
+        if (oldIsEnforced != isEnforced) {
+            PublishBestChainLock();
+        }
     }
 }
 
@@ -1509,55 +1522,57 @@ void CChainLocksHandler::ProcessPendingRecoveredChainLockSigs()
 
 bool CChainLocksHandler::HasChainLock(int nHeight, const uint256& blockHash)
 {
-    LOCK(cs);
-    return InternalHasChainLock(nHeight, blockHash);
+    const auto snapshot = GetBestChainLockSnapshot();
+    return snapshot->fEnforced && IsLockedBy(snapshot->pindex, nHeight, blockHash);
 }
 
 bool CChainLocksHandler::InternalHasChainLock(int nHeight, const uint256& blockHash) const
 {
-    if (!isEnforced) {
-        return false;
-    }
-    if (!bestChainLockBlockIndex) {
+    return isEnforced && IsLockedBy(bestChainLockBlockIndex, nHeight, blockHash);
+}
+
+bool CChainLocksHandler::IsLockedBy(const CBlockIndex* pindexBest, int nHeight, const uint256& blockHash)
+{
+    if (!pindexBest) {
         return false;
     }
-    if (nHeight > bestChainLockBlockIndex->nHeight) {
+    if (nHeight > pindexBest->nHeight) {
         return false;
     }
-    if (nHeight == bestChainLockBlockIndex->nHeight) {
-        return blockHash == bestChainLockBlockIndex->GetBlockHash();
+    if (nHeight == pindexBest->nHeight) {
+        return blockHash == pindexBest->GetBlockHash();
     }
 
-    auto pAncestor = bestChainLockBlockIndex->GetAncestor(nHeight);
+    auto pAncestor = pindexBest->GetAncestor(nHeight);
     return pAncestor && pAncestor->GetBlockHash() == blockHash;
 }
 
 bool CChainLocksHandler::HasConflictingChainLock(int nHeight, const uint256& blockHash)
 {
-    LOCK(cs);
-    return InternalHasConflictingChainLock(nHeight, blockHash);
+    const auto snapshot = GetBestChainLockSnapshot();
+    return snapshot->fEnforced && ConflictsWith(snapshot->pindex, nHeight, blockHash);
 }
 
-
 bool CChainLocksHandler::InternalHasConflictingChainLock(int nHeight, const uint256& blockHash) const
 {
-    if (!isEnforced) {
-        return false;
-    }
+    return isEnforced && ConflictsWith(bestChainLockBlockIndex, nHeight, blockHash);
+}
 
-    if (!bestChainLockBlockIndex) {
+bool CChainLocksHandler::ConflictsWith(const CBlockIndex* pindexBest, int nHeight, const uint256& blockHash)
+{
+    if (!pindexBest) {
         return false;
     }
 
-    if (nHeight > bestChainLockBlockIndex->nHeight) {
+    if (nHeight > pindexBest->nHeight) {
         return false;
     }
 
-    if (nHeight == bestChainLockBlockIndex->nHeight) {
-        return blockHash != bestChainLockBlockIndex->GetBlockHash();
+    if (nHeight == pindexBest->nHeight) {
+        return blockHash != pindexBest->GetBlockHash();
     }
 
-    auto pAncestor = bestChainLockBlockIndex->GetAncestor(nHeight);
+    auto pAncestor = pindexBest->GetAncestor(nHeight);
     assert(pAncestor);
     return pAncestor->GetBlockHash() != blockHash;
 }
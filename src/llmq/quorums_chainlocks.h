@@ -105,6 +105,19 @@ private:
 
     int64_t lastCleanupTime GUARDED_BY(cs) {0};
 
+    // Immutable copy of the best ChainLock state, republished under cs whenever that state changes. Validation,
+    // mining, RPC and net threads query it constantly, so they read the snapshot instead of contending on cs.
+    // cs_snapshot is a leaf lock which is only held to copy or swap the pointer.
+    struct BestChainLockSnapshot
+    {
+        CChainLockSig clsig;
+        const CBlockIndex* pindex{nullptr};
+        bool fEnforced{false};
+    };
+    using BestChainLockSnapshotPtr = std::shared_ptr<const BestChainLockSnapshot>;
+    mutable Mutex cs_snapshot;
+    BestChainLockSnapshotPtr bestSnapshot GUARDED_BY(cs_snapshot) {std::make_shared<const BestChainLockSnapshot>()};
+
 public:
     CConnman& connman;
     PeerManager& peerman;
@@ -118,8 +131,8 @@ public:
     bool AlreadyHave(const uint256& hash) EXCLUSIVE_LOCKS_REQUIRED(!cs);
     bool GetChainLockByHash(const uint256& hash, CChainLockSig& ret) EXCLUSIVE_LOCKS_REQUIRED(!cs);
     CChainLockSig GetMostRecentChainLock() EXCLUSIVE_LOCKS_REQUIRED(!cs);
-    CChainLockSig GetBestChainLock() EXCLUSIVE_LOCKS_REQUIRED(!cs);
-    const CBlockIndex* GetBestChainLockIndex() EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    CChainLockSig GetBestChainLock() EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
+    const CBlockIndex* GetBestChainLockIndex() EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
     std::map<CQuorumCPtr, CChainLockSigCPtr> GetBestChainLockShares() EXCLUSIVE_LOCKS_REQUIRED(!cs);
 
     void ProcessMessage(CNode* pfrom, const std::string& strCommand, CDataStream& vRecv) EXCLUSIVE_LOCKS_REQUIRED(!cs);
@@ -130,8 +143,8 @@ public:
     void TrySignChainTip() EXCLUSIVE_LOCKS_REQUIRED(!cs);
     void HandleNewRecoveredSig(const CRecoveredSig& recoveredSig) override EXCLUSIVE_LOCKS_REQUIRED(!cs);
     bool GetCLSIGFromPeers();
-    bool HasChainLock(int nHeight, const uint256& blockHash) EXCLUSIVE_LOCKS_REQUIRED(!cs);
-    bool HasConflictingChainLock(int nHeight, const uint256& blockHash) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    bool HasChainLock(int nHeight, const uint256& blockHash) EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
+    bool HasConflictingChainLock(int nHeight, const uint256& blockHash) EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
     bool VerifyAggregatedChainLock(const CChainLockSig& clsig, const CBlockIndex* pindexScan, const uint256& hash, bool* retSigVerifyAttempted = nullptr) LOCKS_EXCLUDED(cs_main) EXCLUSIVE_LOCKS_REQUIRED(!cs);
     bool GetRecentChainLockByHeight(int32_t nHeight, CChainLockSig& ret) EXCLUSIVE_LOCKS_REQUIRED(!cs);
 private:
@@ -164,6 +177,11 @@ private:
         EXCLUSIVE_LOCKS_REQUIRED(cs_main);
     bool InternalHasChainLock(int nHeight, const uint256& blockHash) const EXCLUSIVE_LOCKS_REQUIRED(cs);
     bool InternalHasConflictingChainLock(int nHeight, const uint256& blockHash) const EXCLUSIVE_LOCKS_REQUIRED(cs);
+    static bool IsLockedBy(const CBlockIndex* pindexBest, int nHeight, const uint256& blockHash);
+    static bool ConflictsWith(const CBlockIndex* pindexBest, int nHeight, const uint256& blockHash);
+
+    void PublishBestChainLock() EXCLUSIVE_LOCKS_REQUIRED(cs, !cs_snapshot);
+    BestChainLockSnapshotPtr GetBestChainLockSnapshot() const EXCLUSIVE_LOCKS_REQUIRED(!cs_snapshot);
 
     void AddRecentChainLock(const CChainLockSig& clsig) EXCLUSIVE_LOCKS_REQUIRED(cs);
     void ProcessPendingRecoveredChainLockSigs() EXCLUSIVE_LOCKS_REQUIRED(!cs);
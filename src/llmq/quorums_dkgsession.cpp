@@ -313,66 +313,110 @@ void CDKGSession::ReceiveMessage(const uint256& hash, const CDKGContribution& qc
 
     receivedSkContributions[member->idx] = skContribution;
     LOCK(cs_pending);
+    MergeVerifiedContributions(false);
     pendingContributionVerifications.emplace_back(member->idx);
-    if (pendingContributionVerifications.size() >= 32) {
+    if (pendingContributionVerifications.size() >= CONTRIBUTION_VERIFY_BATCH_SIZE) {
         VerifyPendingContributions();
     }
 }
 
-// Verifies all pending secret key contributions in one batch
+// Starts verification of all pending secret key contributions as one batch on the BLS worker
 // This is done by aggregating the verification vectors belonging to the secret key contributions
 // The resulting aggregated vvec is then used to recover a public key share
 // The public key share must match the public key belonging to the aggregated secret key contributions
-// See CBLSWorker::VerifyContributionShares for more details.
+// See CBLSWorker::VerifyContributionShares for more details. Results are picked up by MergeVerifiedContributions.
 void CDKGSession::VerifyPendingContributions()
 {
     AssertLockHeld(cs_pending);
 
-    CDKGLogger logger(*this, __func__, __LINE__);
-
-    cxxtimer::Timer t1(true);
-
     if (pendingContributionVerifications.empty()) {
         return;
     }
 
-    std::vector<size_t> memberIndexes;
-    std::vector<BLSVerificationVectorPtr> vvecs;
-    std::vector<CBLSSecretKey> skContributions;
-
+    auto batch = std::make_unique<ContributionVerifyBatch>();
     for (const auto& idx : pendingContributionVerifications) {
         const auto& m = members[idx];
         if (m->bad || m->weComplain) {
             continue;
         }
-        memberIndexes.emplace_back(idx);
-        vvecs.emplace_back(receivedVvecs[idx]);
-        skContributions.emplace_back(receivedSkContributions[idx]);
+        batch->memberIndexes.emplace_back(idx);
+        batch->vvecs.emplace_back(receivedVvecs[idx]);
+        batch->skContributions.emplace_back(receivedSkContributions[idx]);
+    }
+    pendingContributionVerifications.clear();
+    if (batch->memberIndexes.empty()) {
+        return;
     }
 
-    auto result = blsWorker.VerifyContributionShares(myId, vvecs, skContributions);
-    if (result.size() != memberIndexes.size()) {
-        logger.Batch("VerifyContributionShares returned result of size %d but size %d was expected, something is wrong", result.size(), memberIndexes.size());
+    batch->result = blsWorker.AsyncVerifyContributionShares(myId, batch->vvecs, batch->skContributions, true, true);
+    inFlightContributionVerifications.emplace_back(std::move(batch));
+}
+
+// Applies the results of finished contribution batches. With fWait, blocks until all started batches are done
+void CDKGSession::MergeVerifiedContributions(bool fWait)
+{
+    AssertLockHeld(cs_pending);
+
+    if (inFlightContributionVerifications.empty()) {
         return;
     }
 
-    for (size_t i = 0; i < memberIndexes.size(); i++) {
-        if (!result[i]) {
-            const auto& m = members[memberIndexes[i]];
-            logger.Batch("invalid contribution from %s. will complain later", m->dmn->proTxHash.ToString());
-            m->weComplain = true;
-            quorumDKGDebugManager->UpdateLocalMemberStatus(m->idx, [&](CDKGDebugMemberStatus& status) {
-                status.statusBits.weComplain = true;
-                return true;
-            });
-        } else {
-            size_t memberIdx = memberIndexes[i];
-            dkgManager.WriteVerifiedSkContribution(m_quorum_base_block_index->GetBlockHash(), members[memberIdx]->dmn->proTxHash, skContributions[i]);
+    CDKGLogger logger(*this, __func__, __LINE__);
+    cxxtimer::Timer t1(true);
+    size_t mergedCount{0};
+
+    auto it = inFlightContributionVerifications.begin();
+    while (it != inFlightContributionVerifications.end()) {
+        auto& batch = **it;
+        if (!fWait && batch.result.wait_for(std::chrono::seconds::zero()) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+
+        std::vector<bool> result;
+        try {
+            result = batch.result.get();
+        } catch (const std::future_error& e) {
+            // only happens when the BLS worker was stopped with this batch still queued
+            logger.Batch("contribution verification was aborted: %s", e.what());
+            it = inFlightContributionVerifications.erase(it);
+            continue;
+        }
+        if (result.size() != batch.memberIndexes.size()) {
+            logger.Batch("VerifyContributionShares returned result of size %d but size %d was expected, something is wrong", result.size(), batch.memberIndexes.size());
+            it = inFlightContributionVerifications.erase(it);
+            continue;
+        }
+
+        for (size_t i = 0; i < batch.memberIndexes.size(); i++) {
+            const auto& m = members[batch.memberIndexes[i]];
+            if (!result[i]) {
+                logger.Batch("invalid contribution from %s. will complain later", m->dmn->proTxHash.ToString());
+                m->weComplain = true;
+                quorumDKGDebugManager->UpdateLocalMemberStatus(m->idx, [&](CDKGDebugMemberStatus& status) {
+                    status.statusBits.weComplain = true;
+                    return true;
+                });
+            } else {
+                dkgManager.WriteVerifiedSkContribution(m_quorum_base_block_index->GetBlockHash(), m->dmn->proTxHash, batch.skContributions[i]);
+            }
         }
+        mergedCount += batch.memberIndexes.size();
+        it = inFlightContributionVerifications.erase(it);
     }
 
-    logger.Batch("verified %d pending contributions. time=%d", pendingContributionVerifications.size(), t1.count());
-    pendingContributionVerifications.clear();
+    if (mergedCount != 0) {
+        logger.Batch("merged %d verified contributions, %d batches still in flight. time=%d", mergedCount, inFlightContributionVerifications.size(), t1.count());
+    }
+}
+
+CDKGSession::~CDKGSession()
+{
+    // the BLS worker reads from the in-flight batches, they must not go away before it is done with them
+    LOCK(cs_pending);
+    for (const auto& batch : inFlightContributionVerifications) {
+        batch->result.wait();
+    }
 }
 
 void CDKGSession::VerifyAndComplain(CDKGPendingMessages& pendingMessages)
@@ -384,6 +428,7 @@ void CDKGSession::VerifyAndComplain(CDKGPendingMessages& pendingMessages)
     {
         LOCK(cs_pending);
         VerifyPendingContributions();
+        MergeVerifiedContributions(true);
     }
 
     CDKGLogger logger(*this, __func__, __LINE__);
@@ -14,6 +14,8 @@
 
 #include <sync.h>
 
+#include <future>
+#include <memory>
 #include <optional>
 
 class UniValue;
@@ -298,8 +300,20 @@ private:
     std::map<uint256, CDKGJustification> justifications GUARDED_BY(invCs);
     std::map<uint256, CDKGPrematureCommitment> prematureCommitments GUARDED_BY(invCs);
 
+    // Contributions are verified in small batches on the BLS worker while the contribution phase is still running,
+    // so that only the last (partial) batch is left to verify when the phase ends. A batch owns the inputs the
+    // worker is reading from and is merged back into the session on the session handler thread.
+    static constexpr size_t CONTRIBUTION_VERIFY_BATCH_SIZE{8};
+    struct ContributionVerifyBatch {
+        std::vector<size_t> memberIndexes;
+        std::vector<BLSVerificationVectorPtr> vvecs;
+        std::vector<CBLSSecretKey> skContributions;
+        std::future<std::vector<bool>> result;
+    };
+
     mutable Mutex cs_pending;
     std::vector<size_t> pendingContributionVerifications GUARDED_BY(cs_pending);
+    std::vector<std::unique_ptr<ContributionVerifyBatch>> inFlightContributionVerifications GUARDED_BY(cs_pending);
 
     // filled by ReceivePrematureCommitment and used by FinalizeCommitments
     std::set<uint256> validCommitments GUARDED_BY(invCs);
@@ -307,6 +321,7 @@ private:
 public:
     CDKGSession(CBLSWorker& _blsWorker, CDKGSessionManager& _dkgManager) :
         blsWorker(_blsWorker), cache(_blsWorker), dkgManager(_dkgManager) {}
+    ~CDKGSession();
 
     bool Init(const CBlockIndex* pQuorumBaseBlockIndex, const std::vector<CDeterministicMNCPtr>& mns, const uint256& _myProTxHash);
 
@@ -331,6 +346,7 @@ public:
     bool PreVerifyMessage(const CDKGContribution& qc, bool& retBan) const;
     void ReceiveMessage(const uint256& hash, const CDKGContribution& qc) EXCLUSIVE_LOCKS_REQUIRED(!invCs, !cs_pending);
     void VerifyPendingContributions() EXCLUSIVE_LOCKS_REQUIRED(cs_pending);
+    void MergeVerifiedContributions(bool fWait) EXCLUSIVE_LOCKS_REQUIRED(cs_pending);
 
     // Phase 2: complaint
     void VerifyAndComplain(CDKGPendingMessages& pendingMessages) EXCLUSIVE_LOCKS_REQUIRED(!cs_pending);
@@ -5,6 +5,7 @@
 #include <llmq/quorums_init.h>
 
 #include <llmq/quorums.h>
+#include <llmq/quorums_aggsigcache.h>
 #include <llmq/quorums_blockprocessor.h>
 #include <llmq/quorums_commitment.h>
 #include <llmq/quorums_debug.h>
@@ -32,6 +33,7 @@ void InitLLMQSystem(const DBParams& quorumCommitmentDB, const DBParams& quorumVe
     quorumManager = new CQuorumManager(quorumVectorDB, quorumSkDB, *blsWorker, *quorumDKGSessionManager, chainman);
     quorumSigSharesManager = new CSigSharesManager(connman, peerman);
     quorumSigningManager = new CSigningManager(unitTests, peerman, chainman, fWipe);
+    aggregatedSigCache = new CAggregatedSigCache();
     chainLocksHandler = new CChainLocksHandler(connman, peerman, chainman);
     btcCheckpointsHandler = new CBTCCheckpointsHandler(connman, peerman, chainman);
 }
@@ -42,6 +44,8 @@ void DestroyLLMQSystem()
     btcCheckpointsHandler = nullptr;
     delete chainLocksHandler;
     chainLocksHandler = nullptr;
+    delete aggregatedSigCache;
+    aggregatedSigCache = nullptr;
     delete quorumSigningManager;
     quorumSigningManager = nullptr;
     delete quorumSigSharesManager;
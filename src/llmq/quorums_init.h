@@ -5,6 +5,7 @@
 #ifndef SYSCOIN_LLMQ_QUORUMS_INIT_H
 #define SYSCOIN_LLMQ_QUORUMS_INIT_H
 
+class CBLSWorker;
 class CDBWrapper;
 class CConnman;
 class BanMan;
@@ -14,6 +15,8 @@ struct DBParams;
 namespace llmq
 {
 
+extern CBLSWorker* blsWorker;
+
 // If true, we will connect to all new quorums and watch their communication
 static const bool DEFAULT_WATCH_QUORUMS = false;
 
@@ -11,6 +11,7 @@
 #include <masternode/activemasternode.h>
 #include <bls/bls_batchverifier.h>
 #include <chainparams.h>
+#include <common/bloom.h>
 #include <cxxtimer.hpp>
 #include <init.h>
 #include <dbwrapper.h>
@@ -22,10 +23,13 @@
 #include <timedata.h>
 
 #include <algorithm>
+#include <optional>
 #include <unordered_set>
 #include <common/args.h>
 #include <evo/deterministicmns.h>
 #include <logging.h>
+#include <util/fs.h>
+#include <util/strencodings.h>
 #include <util/thread.h>
 
 namespace llmq
@@ -44,110 +48,234 @@ UniValue CRecoveredSig::ToJson() const
 }
 
 
-CRecoveredSigsDb::CRecoveredSigsDb(bool fMemory, bool fWipe) :
-        db(std::make_unique<CDBWrapper>(DBParams{fMemory ? "" : (gArgs.GetDataDirNet() / "llmq/recsigdb"), 8 << 20, fMemory, fWipe}))
+// SYSCOIN
+struct CRecoveredSigsDb::Bucket
 {
+    // A single filter only holds FILTER_ELEMENTS entries at the wanted false positive rate, more are chained
+    static constexpr unsigned int FILTER_ELEMENTS{10000};
+    static constexpr double FILTER_FP_RATE{0.001};
+
+    const int64_t nStart;
+    const int64_t nEnd;
+    // empty for in-memory buckets
+    const fs::path path;
+    std::unique_ptr<CDBWrapper> db;
+    // set when the bucket was dropped, its files are removed once the last reader is done with it
+    std::atomic<bool> fExpired{false};
+
+    // Existence filter over the ids, sign hashes and object hashes of the sigs stored in this bucket. It never has
+    // false negatives, so a miss saves the LevelDB lookup. Truncated sigs are not removed, a stale hit only costs a lookup.
+    mutable Mutex cs_filter;
+    std::vector<CBloomFilter> filters GUARDED_BY(cs_filter);
+    unsigned int nLastFilterElements GUARDED_BY(cs_filter){0};
+
+    Bucket(int64_t _nStart, int64_t _nEnd, fs::path _path, bool fMemory) :
+        nStart(_nStart),
+        nEnd(_nEnd),
+        path(std::move(_path)),
+        db(std::make_unique<CDBWrapper>(DBParams{path, 2 << 20, fMemory, false}))
+    {
+        std::unique_ptr<CDBIterator> pcursor(db->NewIterator());
+        for (pcursor->SeekToFirst(); pcursor->Valid(); pcursor->Next()) {
+            std::pair<std::string, uint256> k;
+            if (pcursor->GetKey(k)) {
+                AddToFilter(k.second);
+            }
+        }
+    }
+
+    ~Bucket()
+    {
+        db.reset();
+        if (fExpired && !path.empty()) {
+            std::error_code ec;
+            fs::remove_all(path, ec);
+            if (ec) {
+                LogPrintf("CRecoveredSigsDb::%s -- failed to remove %s: %s\n", __func__, fs::PathToString(path), ec.message());
+            }
+        }
+    }
+
+    void AddToFilter(const uint256& key) EXCLUSIVE_LOCKS_REQUIRED(!cs_filter)
+    {
+        LOCK(cs_filter);
+        if (filters.empty() || nLastFilterElements >= FILTER_ELEMENTS) {
+            filters.emplace_back(FILTER_ELEMENTS, FILTER_FP_RATE, GetRand<unsigned int>(), BLOOM_UPDATE_NONE);
+            nLastFilterElements = 0;
+        }
+        filters.back().insert(key);
+        nLastFilterElements++;
+    }
+
+    bool MaybeContains(const uint256& key) const EXCLUSIVE_LOCKS_REQUIRED(!cs_filter)
+    {
+        LOCK(cs_filter);
+        return std::any_of(filters.begin(), filters.end(), [&](const CBloomFilter& filter) { return filter.contains(key); });
+    }
+};
+
+static fs::path GetRecoveredSigsBucketsDir()
+{
+    return gArgs.GetDataDirNet() / "llmq" / "recsigdb_buckets";
 }
 
-CRecoveredSigsDb::~CRecoveredSigsDb() = default;
+// Buckets are stored as "<start>_<end>", buckets of the legacy fixed width as "<start>"
+static std::optional<std::pair<int64_t, int64_t>> ParseRecoveredSigsBucketName(const std::string& name, int64_t nLegacyWidth)
+{
+    const auto pos = name.find('_');
+    if (pos == std::string::npos) {
+        const auto nStart = ToIntegral<int64_t>(name);
+        if (!nStart || *nStart % nLegacyWidth != 0) return std::nullopt;
+        return std::make_pair(*nStart, *nStart + nLegacyWidth);
+    }
+    const auto nStart = ToIntegral<int64_t>(name.substr(0, pos));
+    const auto nEnd = ToIntegral<int64_t>(name.substr(pos + 1));
+    if (!nStart || !nEnd || *nEnd <= *nStart) return std::nullopt;
+    return std::make_pair(*nStart, *nEnd);
+}
 
-bool CRecoveredSigsDb::HasRecoveredSig(const uint256& id, const uint256& msgHash) const
+int64_t CRecoveredSigsDb::GetBucketWidth(int64_t maxAge)
 {
-    auto k = std::make_tuple(std::string("rs_r"), id, msgHash);
-    return db->Exists(k);
+    // sigs of the current bucket plus those of every bucket overlapping the last maxAge seconds
+    return std::max(RECSIG_MIN_BUCKET_WIDTH, maxAge / (RECSIG_MAX_BUCKETS - 1));
 }
 
-bool CRecoveredSigsDb::HasRecoveredSigForId(const uint256& id) const
+CRecoveredSigsDb::CRecoveredSigsDb(bool _fMemory, bool fWipe) :
+        fMemory(_fMemory),
+        nBucketWidth(GetBucketWidth(gArgs.GetIntArg("-maxrecsigsage", DEFAULT_MAX_RECOVERED_SIGS_AGE))),
+        db(std::make_unique<CDBWrapper>(DBParams{fMemory ? "" : (gArgs.GetDataDirNet() / "llmq/recsigdb"), 8 << 20, fMemory, fWipe}))
 {
-    auto cacheKey = id;
-    bool ret;
     {
-        LOCK(cs_cache);
-        if (hasSigForIdCache.get(cacheKey, ret)) {
-            return ret;
-        }
+        std::unique_ptr<CDBIterator> pcursor(db->NewIterator());
+        auto start = std::make_tuple(std::string("rs_t"), (uint32_t)0, uint256());
+        pcursor->Seek(start);
+        decltype(start) k;
+        fHasLegacySigs = pcursor->Valid() && pcursor->GetKey(k) && std::get<0>(k) == "rs_t";
     }
 
+    if (fMemory) {
+        return;
+    }
 
-    auto k = std::make_tuple(std::string("rs_r"), id);
-    ret = db->Exists(k);
+    const fs::path bucketsDir = GetRecoveredSigsBucketsDir();
+    if (fWipe) {
+        fs::remove_all(bucketsDir);
+    }
+    fs::create_directories(bucketsDir);
 
-    LOCK(cs_cache);
-    hasSigForIdCache.insert(cacheKey, ret);
-    return ret;
+    LOCK(cs_buckets);
+    for (const auto& entry : fs::directory_iterator(bucketsDir)) {
+        if (!entry.is_directory()) {
+            continue;
+        }
+        const auto range = ParseRecoveredSigsBucketName(fs::PathToString(entry.path().filename()), RECSIG_LEGACY_BUCKET_WIDTH);
+        if (!range) {
+            continue;
+        }
+        buckets.emplace(range->first, std::make_shared<Bucket>(range->first, range->second, entry.path(), false));
+    }
+    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%s -- opened %d buckets of width %d, legacy sigs: %d\n", __func__, buckets.size(), nBucketWidth, fHasLegacySigs.load());
 }
 
-bool CRecoveredSigsDb::HasRecoveredSigForSession(const uint256& signHash) const
+CRecoveredSigsDb::~CRecoveredSigsDb() = default;
+
+CRecoveredSigsDb::BucketPtr CRecoveredSigsDb::GetOrCreateBucket(int64_t nTime)
 {
-    bool ret;
-    {
-        LOCK(cs_cache);
-        if (hasSigForSessionCache.get(signHash, ret)) {
-            return ret;
+    const int64_t nAligned = nTime - (nTime % nBucketWidth);
+    int64_t nStart = nAligned;
+
+    LOCK(cs_buckets);
+    if (!buckets.empty()) {
+        const BucketPtr& newest = buckets.rbegin()->second;
+        // also taken when the clock went backwards, the sig then merely expires with the newest bucket
+        if (nTime < newest->nEnd) {
+            return newest;
         }
+        // buckets written with another -maxrecsigsage may end past the aligned start, never overlap them
+        nStart = std::max(nStart, newest->nEnd);
     }
-
-    auto k = std::make_tuple(std::string("rs_s"), signHash);
-    ret = db->Exists(k);
-
-    LOCK(cs_cache);
-    hasSigForSessionCache.insert(signHash, ret);
-    return ret;
+    const int64_t nEnd = nAligned + nBucketWidth;
+    fs::path path = fMemory ? fs::path{} : GetRecoveredSigsBucketsDir() / fs::u8path(strprintf("%d_%d", nStart, nEnd));
+    auto it = buckets.emplace(nStart, std::make_shared<Bucket>(nStart, nEnd, std::move(path), fMemory)).first;
+    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%s -- created bucket %d-%d\n", __func__, nStart, nEnd);
+    return it->second;
 }
 
-bool CRecoveredSigsDb::HasRecoveredSigForHash(const uint256& hash) const
+template <typename Callable>
+bool CRecoveredSigsDb::FindInBuckets(const uint256& filterKey, Callable&& func) const
 {
-    bool ret;
+    std::vector<BucketPtr> candidates;
     {
-        LOCK(cs_cache);
-        if (hasSigForHashCache.get(hash, ret)) {
-            return ret;
+        LOCK(cs_buckets);
+        for (auto it = buckets.rbegin(); it != buckets.rend(); ++it) {
+            candidates.emplace_back(it->second);
         }
     }
+    for (const auto& bucket : candidates) {
+        if (bucket->MaybeContains(filterKey) && func(*bucket->db)) {
+            return true;
+        }
+    }
+    return fHasLegacySigs && func(*db);
+}
 
-    auto k = std::make_tuple(std::string("rs_h"), hash);
-    ret = db->Exists(k);
-
-    LOCK(cs_cache);
-    hasSigForHashCache.insert(hash, ret);
-    return ret;
+bool CRecoveredSigsDb::HasRecoveredSig(const uint256& id, const uint256& msgHash) const
+{
+    auto k = std::make_tuple(std::string("rs_r"), id, msgHash);
+    return FindInBuckets(id, [&](const CDBWrapper& sigDb) { return sigDb.Exists(k); });
 }
 
-bool CRecoveredSigsDb::ReadRecoveredSig(const uint256& id, CRecoveredSig& ret) const
+bool CRecoveredSigsDb::HasRecoveredSigForId(const uint256& id) const
 {
     auto k = std::make_tuple(std::string("rs_r"), id);
-    return db->Read(k, ret);
+    return FindInBuckets(id, [&](const CDBWrapper& sigDb) { return sigDb.Exists(k); });
+}
 
+bool CRecoveredSigsDb::HasRecoveredSigForSession(const uint256& signHash) const
+{
+    auto k = std::make_tuple(std::string("rs_s"), signHash);
+    return FindInBuckets(signHash, [&](const CDBWrapper& sigDb) { return sigDb.Exists(k); });
+}
+
+bool CRecoveredSigsDb::HasRecoveredSigForHash(const uint256& hash) const
+{
+    auto k = std::make_tuple(std::string("rs_h"), hash);
+    return FindInBuckets(hash, [&](const CDBWrapper& sigDb) { return sigDb.Exists(k); });
+}
+
+bool CRecoveredSigsDb::ReadRecoveredSig(const CDBWrapper& sigDb, const uint256& id, CRecoveredSig& ret)
+{
+    auto k = std::make_tuple(std::string("rs_r"), id);
+    return sigDb.Read(k, ret);
 }
 
 bool CRecoveredSigsDb::GetRecoveredSigByHash(const uint256& hash, CRecoveredSig& ret) const
 {
     auto k1 = std::make_tuple(std::string("rs_h"), hash);
-    uint256 k2;
-    if (!db->Read(k1, k2)) {
-        return false;
-    }
-
-    return ReadRecoveredSig(k2, ret);
+    // the id and the recSig are always written to the same bucket
+    return FindInBuckets(hash, [&](const CDBWrapper& sigDb) {
+        uint256 k2;
+        return sigDb.Read(k1, k2) && ReadRecoveredSig(sigDb, k2, ret);
+    });
 }
 
 bool CRecoveredSigsDb::GetRecoveredSigById(const uint256& id, CRecoveredSig& ret) const
 {
-    return ReadRecoveredSig(id, ret);
+    return FindInBuckets(id, [&](const CDBWrapper& sigDb) { return ReadRecoveredSig(sigDb, id, ret); });
 }
 
 void CRecoveredSigsDb::WriteRecoveredSig(const llmq::CRecoveredSig& recSig)
 {
-    CDBBatch batch(*db);
-
     uint32_t curTime = GetTime<std::chrono::seconds>().count();
+    auto bucket = GetOrCreateBucket(curTime);
+
+    CDBBatch batch(*bucket->db);
 
     // we put these close to each other to leverage leveldb's key compaction
     // this way, the second key can be used for fast HasRecoveredSig checks while the first key stores the recSig
     auto k1 = std::make_tuple(std::string("rs_r"), recSig.getId());
     auto k2 = std::make_tuple(std::string("rs_r"), recSig.getId(), recSig.getMsgHash());
     batch.Write(k1, recSig);
-    // this key is also used to store the current time, so that we can easily get to the "rs_t" key when we have the id
     batch.Write(k2, curTime);
 
     // store by object hash
@@ -159,24 +287,18 @@ void CRecoveredSigsDb::WriteRecoveredSig(const llmq::CRecoveredSig& recSig)
     auto k4 = std::make_tuple(std::string("rs_s"), signHash);
     batch.Write(k4, (uint8_t)1);
 
-    // store by current time. Allows fast cleanup of old recSigs
-    auto k5 = std::make_tuple(std::string("rs_t"), (uint32_t)htobe32_internal(curTime), recSig.getId());
-    batch.Write(k5, (uint8_t)1);
-
-    db->WriteBatch(batch);
+    // no time index needed, the bucket itself is dropped once it is too old
+    bucket->db->WriteBatch(batch);
 
-    {
-        LOCK(cs_cache);
-        hasSigForIdCache.insert(recSig.getId(), true);
-        hasSigForSessionCache.insert(signHash, true);
-        hasSigForHashCache.insert(recSig.GetHash(), true);
-    }
+    bucket->AddToFilter(recSig.getId());
+    bucket->AddToFilter(recSig.GetHash());
+    bucket->AddToFilter(signHash);
 }
 
-void CRecoveredSigsDb::RemoveRecoveredSig(CDBBatch& batch, const uint256& id, bool deleteHashKey, bool deleteTimeKey)
+void CRecoveredSigsDb::RemoveRecoveredSig(const CDBWrapper& sigDb, CDBBatch& batch, const uint256& id, bool deleteHashKey)
 {
     CRecoveredSig recSig;
-    if (!ReadRecoveredSig(id, recSig)) {
+    if (!ReadRecoveredSig(sigDb, id, recSig)) {
         return;
     }
 
@@ -192,33 +314,56 @@ void CRecoveredSigsDb::RemoveRecoveredSig(CDBBatch& batch, const uint256& id, bo
         batch.Erase(k3);
     }
     batch.Erase(k4);
+}
+
+// Remove the recovered sig itself and all keys required to get from id -> recSig
+// This will leave the byHash key in-place so that HasRecoveredSigForHash still returns true
+void CRecoveredSigsDb::TruncateRecoveredSig(const uint256& id)
+{
+    auto k = std::make_tuple(std::string("rs_r"), id);
+    FindInBuckets(id, [&](CDBWrapper& sigDb) {
+        if (!sigDb.Exists(k)) {
+            return false;
+        }
+        CDBBatch batch(sigDb);
+        RemoveRecoveredSig(sigDb, batch, id, false);
+        sigDb.WriteBatch(batch);
+        return true;
+    });
+}
+
+void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
+{
+    const int64_t endTime = GetTime<std::chrono::seconds>().count() - maxAge;
 
-    if (deleteTimeKey) {
-        uint32_t writeTime;
-        if (db->Read(k2, writeTime)) {
-            auto k5 = std::make_tuple(std::string("rs_t"), (uint32_t) htobe32_internal(writeTime), recSig.getId());
-            batch.Erase(k5);
+    std::vector<int64_t> dropped;
+    {
+        LOCK(cs_buckets);
+        // a bucket is only dropped once all of its sigs are older than maxAge
+        for (auto it = buckets.begin(); it != buckets.end() && it->second->nEnd <= endTime;) {
+            it->second->fExpired = true;
+            dropped.emplace_back(it->first);
+            it = buckets.erase(it);
         }
     }
+    for (const auto nStart : dropped) {
+        LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%s -- dropped bucket %d\n", __func__, nStart);
+    }
 
-    LOCK(cs_cache);
-    hasSigForIdCache.erase(recSig.getId());
-    hasSigForSessionCache.erase(signHash);
-    if (deleteHashKey) {
-        hasSigForHashCache.erase(recSig.GetHash());
+    if (fHasLegacySigs) {
+        CleanupLegacyRecoveredSigs(maxAge);
     }
 }
 
-// Remove the recovered sig itself and all keys required to get from id -> recSig
-// This will leave the byHash key in-place so that HasRecoveredSigForHash still returns true
-void CRecoveredSigsDb::TruncateRecoveredSig(const uint256& id)
+size_t CRecoveredSigsDb::GetBucketCount() const
 {
-    CDBBatch batch(*db);
-    RemoveRecoveredSig(batch, id, false, false);
-    db->WriteBatch(batch);
+    LOCK(cs_buckets);
+    return buckets.size();
 }
 
-void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
+// Recovered sigs written before partitioning carry a time index in the main db. Expire them the old way
+// until none are left, after which the main db is no longer consulted for recovered sigs.
+void CRecoveredSigsDb::CleanupLegacyRecoveredSigs(int64_t maxAge)
 {
     std::unique_ptr<CDBIterator> pcursor(db->NewIterator());
 
@@ -228,6 +373,7 @@ void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
 
     std::vector<uint256> toDelete;
     std::vector<decltype(start)> toDelete2;
+    bool fRemaining{false};
 
     while (pcursor->Valid()) {
         decltype(start) k;
@@ -236,6 +382,7 @@ void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
             break;
         }
         if (be32toh_internal(std::get<1>(k)) >= endTime) {
+            fRemaining = true;
             break;
         }
 
@@ -246,13 +393,17 @@ void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
     }
     pcursor.reset();
 
+    if (!fRemaining) {
+        fHasLegacySigs = false;
+    }
+
     if (toDelete.empty()) {
         return;
     }
 
     CDBBatch batch(*db);
     for (const auto& e : toDelete) {
-        RemoveRecoveredSig(batch, e, true, false);
+        RemoveRecoveredSig(*db, batch, e, true);
 
         if (batch.SizeEstimate() >= (1 << 24)) {
             db->WriteBatch(batch);
@@ -266,7 +417,7 @@ void CRecoveredSigsDb::CleanupOldRecoveredSigs(int64_t maxAge)
 
     db->WriteBatch(batch);
 
-    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%d -- deleted %d entries\n", __func__, toDelete.size());
+    LogPrint(BCLog::LLMQ, "CRecoveredSigsDb::%d -- deleted %d legacy entries\n", __func__, toDelete.size());
 }
 
 bool CRecoveredSigsDb::HasVotedOnId(const uint256& id) const
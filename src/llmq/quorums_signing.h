@@ -13,6 +13,9 @@
 #include <util/threadinterrupt.h>
 #include <unordered_lru_cache.h>
 
+#include <atomic>
+#include <map>
+#include <memory>
 #include <unordered_map>
 
 
@@ -105,27 +108,42 @@ public:
 class CRecoveredSigsDb
 {
 private:
+    // SYSCOIN Recovered sigs are partitioned by write time into buckets, each stored in its own LevelDB instance.
+    // Expiring old sigs drops whole buckets instead of deleting them key by key. Every bucket is opened and its
+    // filter rebuilt at startup, so the width follows -maxrecsigsage to keep about RECSIG_MAX_BUCKETS of them alive.
+    static constexpr int64_t RECSIG_MAX_BUCKETS{4};
+    static constexpr int64_t RECSIG_MIN_BUCKET_WIDTH{60 * 60};
+    // width of the buckets written before it depended on -maxrecsigsage, their directory only names the start
+    static constexpr int64_t RECSIG_LEGACY_BUCKET_WIDTH{60 * 60 * 24};
+    struct Bucket;
+    using BucketPtr = std::shared_ptr<Bucket>;
+
+    const bool fMemory;
+    const int64_t nBucketWidth;
+    // votes and recovered sigs written before partitioning was introduced
     std::unique_ptr<CDBWrapper> db{nullptr};
+    std::atomic<bool> fHasLegacySigs{false};
 
-    mutable Mutex cs_cache;
-    mutable unordered_lru_cache<uint256, bool, StaticSaltedHasher, 30000> hasSigForIdCache GUARDED_BY(cs_cache);
-    mutable unordered_lru_cache<uint256, bool, StaticSaltedHasher, 30000> hasSigForSessionCache GUARDED_BY(cs_cache);
-    mutable unordered_lru_cache<uint256, bool, StaticSaltedHasher, 30000> hasSigForHashCache GUARDED_BY(cs_cache);
+    mutable Mutex cs_buckets;
+    // keyed by bucket start time
+    std::map<int64_t, BucketPtr> buckets GUARDED_BY(cs_buckets);
 
 public:
     explicit CRecoveredSigsDb(bool fMemory, bool fWipe);
     ~CRecoveredSigsDb();
 
-    bool HasRecoveredSig(const uint256& id, const uint256& msgHash) const;
-    bool HasRecoveredSigForId(const uint256& id) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool HasRecoveredSigForSession(const uint256& signHash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool HasRecoveredSigForHash(const uint256& hash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool GetRecoveredSigByHash(const uint256& hash, CRecoveredSig& ret) const;
-    bool GetRecoveredSigById(const uint256& id, CRecoveredSig& ret) const;
-    void WriteRecoveredSig(const CRecoveredSig& recSig) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    void TruncateRecoveredSig(const uint256& id) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    bool HasRecoveredSig(const uint256& id, const uint256& msgHash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    bool HasRecoveredSigForId(const uint256& id) const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    bool HasRecoveredSigForSession(const uint256& signHash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    bool HasRecoveredSigForHash(const uint256& hash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    bool GetRecoveredSigByHash(const uint256& hash, CRecoveredSig& ret) const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    bool GetRecoveredSigById(const uint256& id, CRecoveredSig& ret) const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    void WriteRecoveredSig(const CRecoveredSig& recSig) EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    void TruncateRecoveredSig(const uint256& id) EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
 
-    void CleanupOldRecoveredSigs(int64_t maxAge) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    void CleanupOldRecoveredSigs(int64_t maxAge) EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    size_t GetBucketCount() const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    static int64_t GetBucketWidth(int64_t maxAge);
 
     // votes are removed when the recovered sig is written to the db
     bool HasVotedOnId(const uint256& id) const;
@@ -135,8 +153,15 @@ public:
     void CleanupOldVotes(int64_t maxAge);
 
 private:
-    bool ReadRecoveredSig(const uint256& id, CRecoveredSig& ret) const;
-    void RemoveRecoveredSig(CDBBatch& batch, const uint256& id, bool deleteHashKey, bool deleteTimeKey) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    BucketPtr GetOrCreateBucket(int64_t nTime) EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    // Calls func on the db of every bucket that may contain filterKey (newest first) and then on the legacy db,
+    // until func returns true
+    template <typename Callable>
+    bool FindInBuckets(const uint256& filterKey, Callable&& func) const EXCLUSIVE_LOCKS_REQUIRED(!cs_buckets);
+    void CleanupLegacyRecoveredSigs(int64_t maxAge);
+
+    static bool ReadRecoveredSig(const CDBWrapper& sigDb, const uint256& id, CRecoveredSig& ret);
+    static void RemoveRecoveredSig(const CDBWrapper& sigDb, CDBBatch& batch, const uint256& id, bool deleteHashKey);
 };
 
 class CRecoveredSigsListener
@@ -615,7 +615,8 @@ bool CSigSharesManager::ProcessPendingSigShares()
     std::unordered_map<NodeId, std::vector<CSigShare>> sigSharesByNodes;
     std::unordered_map<uint256, CQuorumCPtr, StaticSaltedHasher> quorums;
 
-    const size_t nMaxBatchSize{32};
+    // a failing batch is bisected by source, so a few bad shares don't make large batches expensive
+    const size_t nMaxBatchSize{128};
     bool collect_status = CollectPendingSigSharesToVerify(nMaxBatchSize, sigSharesByNodes, quorums);
     if (!collect_status || sigSharesByNodes.empty()) {
         return false;
@@ -47,9 +47,14 @@ std::vector<CDeterministicMNCPtr> CLLMQUtils::GetAllQuorumMembers(const CBlockIn
         }
     }
 
-    auto allMns = deterministicMNManager->GetListForBlock(pQuorumBaseBlockIndex);
-    auto modifier = pQuorumBaseBlockIndex->GetBlockHash();
-    quorumMembers = allMns.CalculateQuorum(llmqParams.size, modifier);
+    // SYSCOIN members calculated by a previous run
+    if (!quorumManager || !quorumManager->ReadQuorumMembers(pQuorumBaseBlockIndex->GetBlockHash(), quorumMembers)) {
+        auto modifier = pQuorumBaseBlockIndex->GetBlockHash();
+        quorumMembers = deterministicMNManager->CalculateQuorum(pQuorumBaseBlockIndex, llmqParams.size, modifier);
+        if (quorumManager) {
+            quorumManager->WriteQuorumMembers(pQuorumBaseBlockIndex, quorumMembers);
+        }
+    }
     LOCK(cs_members);
     mapQuorumMembers.insert(pQuorumBaseBlockIndex->GetBlockHash(), quorumMembers);
     return quorumMembers;
@@ -66,6 +66,7 @@
 #include <llmq/quorums_signing_shares.h>
 #include <llmq/quorums_chainlocks.h>
 #include <llmq/quorums_btccheckpoints.h>
+#include <services/nevmconsensus.h>
 #include <optional>
 #include <typeinfo>
 #include <common/args.h>
@@ -204,6 +205,13 @@ static constexpr double MAX_ADDR_RATE_PER_SECOND{0.1};
 static constexpr size_t MAX_ADDR_PROCESSING_TOKEN_BUCKET{MAX_ADDR_TO_SEND};
 /** The compactblocks version we support. See BIP 152. */
 static constexpr uint64_t CMPCTBLOCKS_VERSION{2};
+// SYSCOIN
+/** Number of blocks per peer whose stripped PoDA blobs we are willing to serve with getpodablobs */
+static constexpr size_t MAX_PODA_STRIPPED_BLOCKS{4};
+/** Maximum amount of blob data sent in response to one getpodablobs, blobs beyond it are sent empty */
+static constexpr size_t MAX_PODABLOBS_RESPONSE_SIZE{32 * 1024 * 1024};
+/** How long to wait for podablobs before downloading the full block instead */
+static constexpr auto PODA_BLOBS_TIMEOUT{10s};
 
 // Internal stuff
 namespace {
@@ -491,7 +499,11 @@ private:
     void UpdatePeerStateForReceivedHeaders(CNode& pfrom, Peer& peer, const CBlockIndex& last_header, bool received_new_header, bool may_have_more_headers)
         EXCLUSIVE_LOCKS_REQUIRED(g_msgproc_mutex);
 
-    void SendBlockTransactions(CNode& pfrom,  Peer& peer, const CBlock& block, const BlockTransactionsRequest& req) EXCLUSIVE_LOCKS_REQUIRED(!m_most_recent_block_mutex);
+    void SendBlockTransactions(CNode& pfrom,  Peer& peer, const CBlock& block, const BlockTransactionsRequest& req) EXCLUSIVE_LOCKS_REQUIRED(!m_most_recent_block_mutex, g_msgproc_mutex);
+    // SYSCOIN
+    /** Fill the PoDA blobs of a reconstructed block from the blob store, requesting any still missing from the peer.
+     *  Returns false if the block stays in flight, either parked waiting on a PODABLOBS response or requested in full. */
+    bool FillPoDABlobs(CNode& pfrom, Peer& peer, const std::shared_ptr<CBlock>& pblock) EXCLUSIVE_LOCKS_REQUIRED(g_msgproc_mutex);
     /** Register with TxRequestTracker that an INV has been received from a
      *  peer. The announcement parameters are decided in PeerManager and then
      *  passed to TxRequestTracker. */
@@ -2567,10 +2579,58 @@ void PeerManagerImpl::SendBlockTransactions(CNode& pfrom, Peer& peer, const CBlo
         }
         resp.txn[i] = block.vtx[req.indexes[i]];
     }
-
+    // SYSCOIN peers negotiating blob relay get the transactions without their PoDA blobs and fetch the ones they lack by version hash
+    if (peer.m_poda_blob_relay) {
+        std::set<std::vector<uint8_t>> setStripped;
+        for (const auto& tx : resp.txn) {
+            if (!tx->IsNEVMData()) continue;
+            const int nOut = GetSyscoinDataOutput(*tx);
+            if (nOut == -1 || !tx->vout[nOut].HasNEVMData()) continue;
+            CNEVMData nevmData(tx->vout[nOut].scriptPubKey);
+            if (!nevmData.IsNull()) {
+                setStripped.insert(nevmData.vchVersionHash);
+            }
+        }
+        if (!setStripped.empty()) {
+            if (peer.m_poda_stripped_blobs.size() >= MAX_PODA_STRIPPED_BLOCKS) {
+                peer.m_poda_stripped_blobs.pop_front();
+            }
+            peer.m_poda_stripped_blobs.emplace_back(block.GetHash(), std::move(setStripped));
+        }
+        CSerializedNetMsg msg;
+        msg.m_type = NetMsgType::BLOCKTXN;
+        CVectorWriter{SER_NETWORK | SER_NO_PODA, pfrom.GetCommonVersion(), msg.data, 0, resp};
+        m_connman.PushMessage(&pfrom, std::move(msg));
+        return;
+    }
     const CNetMsgMaker msgMaker(pfrom.GetCommonVersion());
     m_connman.PushMessage(&pfrom, msgMaker.Make(NetMsgType::BLOCKTXN, resp));
 }
+// SYSCOIN
+bool PeerManagerImpl::FillPoDABlobs(CNode& pfrom, Peer& peer, const std::shared_ptr<CBlock>& pblock)
+{
+    std::vector<std::vector<uint8_t>> vecMissing;
+    // malformed blob outputs are left for block validation to reject
+    if (!FillNEVMData(*pblock, &vecMissing) || vecMissing.empty()) {
+        return true;
+    }
+    const CNetMsgMaker msgMaker(pfrom.GetCommonVersion());
+    if (vecMissing.size() > (size_t)MAX_DATA_BLOBS) {
+        // more than a single getpodablobs may ask for, download the full block instead
+        LogPrint(BCLog::NET, "Peer %d block %s missing %d PoDA blobs, requesting full block\n", pfrom.GetId(), pblock->GetHash().ToString(), vecMissing.size());
+        std::vector<CInv> invs;
+        invs.emplace_back(MSG_BLOCK | GetFetchFlags(peer), pblock->GetHash());
+        m_connman.PushMessage(&pfrom, msgMaker.Make(NetMsgType::GETDATA, invs));
+        return false;
+    }
+    LogPrint(BCLog::NET, "Peer %d block %s missing %d PoDA blobs, requesting\n", pfrom.GetId(), pblock->GetHash().ToString(), vecMissing.size());
+    PoDABlobsRequest req;
+    req.blockhash = pblock->GetHash();
+    req.vecVersionHashes = vecMissing;
+    peer.m_poda_pending_blocks[req.blockhash] = Peer::PoDAPendingBlock{pblock, std::move(vecMissing), GetTime<std::chrono::microseconds>()};
+    m_connman.PushMessage(&pfrom, msgMaker.Make(NetMsgType::GETPODABLOBS, req));
+    return false;
+}
 
 bool PeerManagerImpl::CheckHeadersPoW(const std::vector<CBlockHeader>& headers, const Consensus::Params& consensusParams, Peer& peer)
 {
@@ -3457,18 +3517,30 @@ void PeerManagerImpl::ProcessCompactBlockTxns(CNode& pfrom, Peer& peer, const Bl
             // though the block was successfully read, and rely on the
             // handling in ProcessNewBlock to ensure the block index is
             // updated, etc.
-            RemoveBlockRequest(block_transactions.blockhash, pfrom.GetId()); // it is now an empty pointer
             fBlockRead = true;
-            // mapBlockSource is used for potentially punishing peers and
-            // updating which peers send us compact blocks, so the race
-            // between here and cs_main in ProcessNewBlock is fine.
-            // BIP 152 permits peers to relay compact blocks after validating
-            // the header only; we should not punish peers if the block turns
-            // out to be invalid.
-            mapBlockSource.emplace(block_transactions.blockhash, std::make_pair(pfrom.GetId(), false));
+            // SYSCOIN a block whose PoDA blobs were stripped by the sender stays in flight until they are filled
+            if (!peer.m_poda_blob_relay) {
+                RemoveBlockRequest(block_transactions.blockhash, pfrom.GetId()); // it is now an empty pointer
+                // mapBlockSource is used for potentially punishing peers and
+                // updating which peers send us compact blocks, so the race
+                // between here and cs_main in ProcessNewBlock is fine.
+                // BIP 152 permits peers to relay compact blocks after validating
+                // the header only; we should not punish peers if the block turns
+                // out to be invalid.
+                mapBlockSource.emplace(block_transactions.blockhash, std::make_pair(pfrom.GetId(), false));
+            }
         }
     } // Don't hold cs_main when we call into ProcessNewBlock
     if (fBlockRead) {
+        // SYSCOIN blobs stripped by the sender are filled locally first and only the missing ones fetched
+        if (peer.m_poda_blob_relay) {
+            if (!FillPoDABlobs(pfrom, peer, pblock)) {
+                return;
+            }
+            LOCK(cs_main);
+            RemoveBlockRequest(block_transactions.blockhash, pfrom.GetId());
+            mapBlockSource.emplace(block_transactions.blockhash, std::make_pair(pfrom.GetId(), false));
+        }
         // Since we requested this block (it was in mapBlocksInFlight), force it to be processed,
         // even if it would not be a candidate for new tip (missing previous block, chain not long enough, etc)
         // This bypasses some anti-DoS logic in AcceptBlock (eg to prevent
@@ -3607,6 +3679,10 @@ void PeerManagerImpl::ProcessMessage(CNode& pfrom, const std::string& msg_type,
             // BIP155 that doesn't announce at least that protocol version number.
             m_connman.PushMessage(&pfrom, msg_maker.Make(NetMsgType::SENDADDRV2));
         }
+        // SYSCOIN signal that blocktxn may be sent to us without PoDA blobs
+        if (greatest_common_version >= PODA_BLOB_RELAY_VERSION) {
+            m_connman.PushMessage(&pfrom, msg_maker.Make(NetMsgType::SENDPODABLOB));
+        }
 
         pfrom.m_has_all_wanted_services = HasAllDesirableServiceFlags(nServices);
         peer->m_their_services = nServices;
@@ -3862,6 +3938,20 @@ void PeerManagerImpl::ProcessMessage(CNode& pfrom, const std::string& msg_type,
         peer->m_wants_addrv2 = true;
         return;
     }
+    // SYSCOIN PoDA blob relay is negotiated between VERSION and VERACK like addrv2
+    if (msg_type == NetMsgType::SENDPODABLOB) {
+        if (pfrom.fSuccessfullyConnected) {
+            LogPrint(BCLog::NET_NETCONN, "sendpodablob received after verack from peer=%d; disconnecting\n", pfrom.GetId());
+            pfrom.fDisconnect = true;
+            return;
+        }
+        if (pfrom.GetCommonVersion() >= PODA_BLOB_RELAY_VERSION) {
+            peer->m_poda_blob_relay = true;
+        } else {
+            LogPrint(BCLog::NET, "ignoring sendpodablob due to old common version=%d from peer=%d\n", pfrom.GetCommonVersion(), pfrom.GetId());
+        }
+        return;
+    }
 
     // Received from a peer demonstrating readiness to announce transactions via reconciliations.
     // This feature negotiation must happen between VERSION and VERACK to avoid relay problems
@@ -4844,10 +4934,95 @@ void PeerManagerImpl::ProcessMessage(CNode& pfrom, const std::string& msg_type,
         }
 
         BlockTransactions resp;
-        vRecv >> resp;
+        // SYSCOIN
+        if (peer->m_poda_blob_relay) {
+            OverrideStream<CDataStream> s(&vRecv, vRecv.GetType() | SER_NO_PODA, vRecv.GetVersion());
+            s >> resp;
+        } else {
+            vRecv >> resp;
+        }
 
         return ProcessCompactBlockTxns(pfrom, *peer, resp);
     }
+    // SYSCOIN
+    if (msg_type == NetMsgType::GETPODABLOBS)
+    {
+        PoDABlobsRequest req;
+        vRecv >> req;
+        if (req.vecVersionHashes.size() > (size_t)MAX_DATA_BLOBS) {
+            Misbehaving(*peer, 100, "getpodablobs with too many version hashes");
+            return;
+        }
+        // only blobs we stripped from a blocktxn sent to this peer are served, and only once
+        std::set<std::vector<uint8_t>> setStripped;
+        const auto it = std::find_if(peer->m_poda_stripped_blobs.begin(), peer->m_poda_stripped_blobs.end(),
+            [&](const auto& entry) { return entry.first == req.blockhash; });
+        if (it != peer->m_poda_stripped_blobs.end()) {
+            setStripped = std::move(it->second);
+            peer->m_poda_stripped_blobs.erase(it);
+        } else {
+            LogPrint(BCLog::NET, "Peer %d asked for PoDA blobs of block %s we did not send it stripped\n", pfrom.GetId(), req.blockhash.ToString());
+        }
+        PoDABlobs resp;
+        resp.blockhash = req.blockhash;
+        resp.vecBlobs.reserve(req.vecVersionHashes.size());
+        size_t nBytes{0};
+        for (const auto& vchVersionHash : req.vecVersionHashes) {
+            auto vchData = std::make_shared<std::vector<uint8_t>>();
+            // an empty blob tells the peer we don't have it. Erasing from the set also sends repeated hashes empty.
+            const bool fServe = setStripped.erase(vchVersionHash) > 0 && !pfrom.fPauseSend && nBytes < MAX_PODABLOBS_RESPONSE_SIZE;
+            if (!fServe || !pnevmdatablobdb || !pnevmdatablobdb->ReadBlob(vchVersionHash, *vchData)) {
+                vchData->clear();
+            }
+            nBytes += vchData->size();
+            resp.vecBlobs.emplace_back(std::move(vchData));
+        }
+        m_connman.PushMessage(&pfrom, CNetMsgMaker(pfrom.GetCommonVersion()).Make(NetMsgType::PODABLOBS, resp));
+        return;
+    }
+
+    if (msg_type == NetMsgType::PODABLOBS)
+    {
+        PoDABlobs resp;
+        vRecv >> resp;
+        auto pending = peer->m_poda_pending_blocks.extract(resp.blockhash);
+        if (pending.empty()) {
+            LogPrint(BCLog::NET, "Peer %d sent us PoDA blobs for block %s we weren't expecting\n", pfrom.GetId(), resp.blockhash.ToString());
+            return;
+        }
+        const std::shared_ptr<CBlock>& pblock = pending.mapped().block;
+        const std::vector<std::vector<uint8_t>>& vecVersionHashes = pending.mapped().vecVersionHashes;
+        if (resp.vecBlobs.size() != vecVersionHashes.size()) {
+            LOCK(cs_main);
+            RemoveBlockRequest(resp.blockhash, pfrom.GetId()); // Reset in-flight state in case Misbehaving does not result in a disconnect
+            Misbehaving(*peer, 100, "podablobs does not match request");
+            return;
+        }
+        std::map<std::vector<uint8_t>, NEVMDataBlobRef> mapBlobs;
+        for (size_t i = 0; i < resp.vecBlobs.size(); i++) {
+            if (resp.vecBlobs[i] && !resp.vecBlobs[i]->empty()) {
+                mapBlobs.emplace(vecVersionHashes[i], std::move(resp.vecBlobs[i]));
+            }
+        }
+        std::vector<std::vector<uint8_t>> vecMissing;
+        FillNEVMData(*pblock, &vecMissing, &mapBlobs);
+        if (!vecMissing.empty()) {
+            // the block is still in flight from this peer, download it in full like a failed compact block
+            LogPrint(BCLog::NET, "Peer %d could not supply %d PoDA blobs for block %s, requesting full block\n", pfrom.GetId(), vecMissing.size(), resp.blockhash.ToString());
+            std::vector<CInv> invs;
+            invs.emplace_back(MSG_BLOCK | GetFetchFlags(*peer), resp.blockhash);
+            m_connman.PushMessage(&pfrom, CNetMsgMaker(pfrom.GetCommonVersion()).Make(NetMsgType::GETDATA, invs));
+            return;
+        }
+        {
+            // the block was requested and fully reconstructed before the blobs were fetched, see ProcessCompactBlockTxns
+            LOCK(cs_main);
+            RemoveBlockRequest(resp.blockhash, pfrom.GetId());
+            mapBlockSource.emplace(resp.blockhash, std::make_pair(pfrom.GetId(), false));
+        }
+        ProcessBlock(pfrom, pblock, /*force_processing=*/true, /*min_pow_checked=*/true);
+        return;
+    }
 
     if (msg_type == NetMsgType::HEADERS)
     {
@@ -6232,6 +6407,18 @@ bool PeerManagerImpl::SendMessages(CNode* pto)
                 return true;
             }
         }
+        // SYSCOIN download blocks in full whose PoDA blobs were not sent in time, they are still in flight from this peer
+        for (auto it = peer->m_poda_pending_blocks.begin(); it != peer->m_poda_pending_blocks.end();) {
+            if (current_time > it->second.m_requested + PODA_BLOBS_TIMEOUT) {
+                LogPrint(BCLog::NET, "Timeout waiting for PoDA blobs of block %s from peer=%d, requesting full block\n", it->first.ToString(), pto->GetId());
+                std::vector<CInv> invs;
+                invs.emplace_back(MSG_BLOCK | GetFetchFlags(*peer), it->first);
+                m_connman.PushMessage(pto, msgMaker.Make(NetMsgType::GETDATA, invs));
+                it = peer->m_poda_pending_blocks.erase(it);
+            } else {
+                ++it;
+            }
+        }
         // Check for headers sync timeouts
         if (state.fSyncStarted && peer->m_headers_sync_timeout < std::chrono::microseconds::max()) {
             // Detect whether this is a stalling initial-headers-sync peer
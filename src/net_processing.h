@@ -10,6 +10,10 @@
 #include <validationinterface.h>
 // SYSCOIN
 #include <headerssync.h>
+
+#include <deque>
+#include <map>
+#include <set>
 class AddrMan;
 class CChainParams;
 class CTxMemPool;
@@ -254,6 +258,22 @@ struct Peer {
     // SYSCOIN
     /** This peer's a masternode connection */
     std::atomic<bool> m_masternode_connection{false};
+    /** Whether this peer sent sendpodablob, so blocktxn both ways carries PoDA blobs stripped */
+    std::atomic_bool m_poda_blob_relay{false};
+    /** Block reconstructed from this peer's blocktxn that waits on the PoDA blobs we asked for with getpodablobs */
+    struct PoDAPendingBlock {
+        std::shared_ptr<CBlock> block;
+        /** Version hashes asked for, in request order */
+        std::vector<std::vector<uint8_t>> vecVersionHashes;
+        /** When getpodablobs was sent */
+        std::chrono::microseconds m_requested;
+    };
+    /** Blocks waiting on a podablobs response from this peer, by block hash. Each stays in flight from this peer
+     *  until its blobs arrive, so their number is bounded by the blocks in flight. */
+    std::map<uint256, PoDAPendingBlock> m_poda_pending_blocks GUARDED_BY(NetEventsInterface::g_msgproc_mutex);
+    /** PoDA blobs stripped from the most recent blocktxn we sent this peer, by block. These are the only blobs it
+     *  may fetch with getpodablobs, and each block's entry is dropped once served. */
+    std::deque<std::pair<uint256, std::set<std::vector<uint8_t>>>> m_poda_stripped_blobs GUARDED_BY(NetEventsInterface::g_msgproc_mutex);
     explicit Peer(NodeId id, ServiceFlags our_services)
         : m_id{id}
         , m_our_services{our_services}
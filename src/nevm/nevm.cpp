@@ -51,11 +51,28 @@ int nibblesToTraverse(const std::string &encodedPartialPath, const std::string &
     return -1;
   }
 }
+bool NEVMTrieNodeCache::Contains(dev::bytesConstRef hash, dev::bytesConstRef node) const
+{
+  if(hash.size() != dev::h256::size) {
+    return false;
+  }
+  LOCK(cs);
+  const auto it = mapNodes.find(dev::h256(hash));
+  return it != mapNodes.end() && node.contentsEqual(it->second);
+}
+
+void NEVMTrieNodeCache::Add(const dev::h256& hash, dev::bytesConstRef node)
+{
+  LOCK(cs);
+  mapNodes.try_emplace(hash, node.toVector());
+}
+
 bool VerifyProof(dev::bytesConstRef path,
                  const dev::RLP& value,
                  const dev::RLP& parentNodes,
                  const dev::RLP& root,
-                 std::optional<uint8_t>* envelope_type) {
+                 std::optional<uint8_t>* envelope_type,
+                 NEVMTrieNodeCache* node_cache) {
   
   dev::RLP currentNode;
   const int len = parentNodes.itemCount();
@@ -68,9 +85,16 @@ bool VerifyProof(dev::bytesConstRef path,
   uint8_t pathInt;
   for (int i = 0 ; i < len ; i++) {
     currentNode = parentNodes[i];
-    if(!nodeKey.payload().contentsEqual(sha3(currentNode.data()).ref().toVector())){
-      return false;
-    } 
+    // a node already hashed for another proof in this block only needs a byte compare
+    if(!node_cache || !node_cache->Contains(nodeKey.payload(), currentNode.data())) {
+      const dev::h256 nodeHash = sha3(currentNode.data());
+      if(!nodeKey.payload().contentsEqual(nodeHash.ref().toVector())){
+        return false;
+      }
+      if(node_cache) {
+        node_cache->Add(nodeHash, currentNode.data());
+      }
+    }
 
     if(pathPtr > (int)pathString.size()){
       return false;
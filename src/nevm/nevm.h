@@ -5,13 +5,28 @@
 #ifndef SYSCOIN_NEVM_NEVM_H
 #define SYSCOIN_NEVM_NEVM_H
 #include <nevm/commondata.h>
+#include <nevm/fixedhash.h>
 #include <nevm/rlp.h>
+#include <sync.h>
 
 #include <optional>
+#include <unordered_map>
+
+/** Trie nodes whose Keccak hash was already checked, keyed by that hash. Mint proofs
+ *  against the same NEVM block share their upper nodes, so one cache per connecting
+ *  block lets each shared node be hashed once. Safe to share across check threads. */
+class NEVMTrieNodeCache {
+    mutable Mutex cs;
+    std::unordered_map<dev::h256, dev::bytes> mapNodes GUARDED_BY(cs);
+public:
+    bool Contains(dev::bytesConstRef hash, dev::bytesConstRef node) const EXCLUSIVE_LOCKS_REQUIRED(!cs);
+    void Add(const dev::h256& hash, dev::bytesConstRef node) EXCLUSIVE_LOCKS_REQUIRED(!cs);
+};
 
 bool VerifyProof(dev::bytesConstRef path,
                  const dev::RLP& value,
                  const dev::RLP& parentNodes,
                  const dev::RLP& root,
-                 std::optional<uint8_t>* envelope_type = nullptr);
+                 std::optional<uint8_t>* envelope_type = nullptr,
+                 NEVMTrieNodeCache* node_cache = nullptr);
 #endif // SYSCOIN_NEVM_NEVM_H
@@ -85,7 +85,7 @@ static ChainstateLoadResult CompleteChainstateInitialization(
         .wipe_data = effective_reindex_geth,
         .options = chainman.m_options.block_tree_db};
     deterministicMNManager.reset();
-    deterministicMNManager.reset(new CDeterministicMNManager(evoDmnDbParams));
+    deterministicMNManager.reset(new CDeterministicMNManager(evoDmnDbParams, options.evodb_diffs));
     governance.reset();
     governance.reset(new CGovernanceManager(chainman));
     sporkManager.reset();
@@ -259,7 +259,7 @@ static ChainstateLoadResult CompleteChainstateInitialization(
             .wipe_data = coinsViewEmpty,
             .options = chainman.m_options.block_tree_db};
         deterministicMNManager.reset();
-        deterministicMNManager.reset(new CDeterministicMNManager(evoDmnDbParams));
+        deterministicMNManager.reset(new CDeterministicMNManager(evoDmnDbParams, options.evodb_diffs));
         governance.reset();
         governance.reset(new CGovernanceManager(chainman));
         sporkManager.reset();
@@ -337,6 +337,11 @@ static ChainstateLoadResult CompleteChainstateInitialization(
             .options = chainman.m_options.block_tree_db});
     }
 
+    // SYSCOIN the persisted mint replay filter is only trusted if it was saved at the best block of the coins view
+    if (pnevmtxmintdb) {
+        pnevmtxmintdb->LoadFilter(chainman.ActiveChainstate().CoinsTip().GetBestBlock());
+    }
+
     // Now that chainstates are loaded and we're able to flush to
     // disk, rebalance the coins caches to desired levels based
     // on the condition of each chainstate.
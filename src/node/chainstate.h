@@ -43,6 +43,7 @@ struct ChainstateLoadOptions {
     BanMan* banman{nullptr};
     PeerManager* peerman{nullptr};
     bool fReindexGeth{false};
+    bool evodb_diffs{false};
 };
 
 //! Chainstate load status. Simple applications can just check for the success
@@ -0,0 +1 @@
+#define BUILD_GIT_COMMIT "70d9933572c7-dirty"
@@ -116,7 +116,7 @@ CTxOut::CTxOut(const CAmount& nValueIn,  const CScript &scriptPubKeyIn)
 {
     nValue = nValueIn;
     scriptPubKey = scriptPubKeyIn;
-    vchNEVMData.clear();
+    vchNEVMData.reset();
     assetInfo.SetNull();
 }
 std::string CTxOut::ToString() const
@@ -760,8 +760,9 @@ bool CNEVMData::UnserializeFromTx(const CTransaction &tx, const int nVersion) {
 		SetNull();
 		return false;
 	}
-    if(!tx.vout[nOut].vchNEVMData.empty()) {
-        vchNEVMData = std::make_shared<const std::vector<uint8_t>>(tx.vout[nOut].vchNEVMData);
+    if(tx.vout[nOut].HasNEVMData()) {
+        // share the output's blob, the payload is immutable so no copy is needed
+        vchNEVMData = tx.vout[nOut].vchNEVMData;
         if(vchNEVMData->size() > MAX_NEVM_DATA_BLOB) {
             SetNull();
             return false;
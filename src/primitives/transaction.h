@@ -431,12 +431,50 @@ bool IsSyscoinNEVMDataTx(const int &nVersion);
 bool IsValidNEVMVersionHash(const std::vector<uint8_t>& vchVersionHash);
 bool DecodeNEVMVersionHash(const std::vector<uint8_t>& version_hash, uint8_t& hash_type, std::vector<uint8_t>& hash_digest);
 std::vector<uint8_t> EncodeNEVMVersionHash(const std::vector<uint8_t>& hash_digest, uint8_t hash_type);
+/** Immutable, reference counted PoDA blob. A blob is allocated once when it is deserialized and then shared by
+ * the transaction output, CNEVMData, the PoDA map and the blob database writer instead of being copied. */
+using NEVMDataBlobRef = std::shared_ptr<const std::vector<uint8_t>>;
+//! Blobs are read in chunks of this size
+static constexpr size_t NEVM_DATA_READ_CHUNK_SIZE = 64 * 1024;
+/**
+ * Formatter to (de)serialize a NEVMDataBlobRef as a plain byte vector, reading straight into the shared allocation.
+ * A null blob serializes as an empty vector. The payload is not hashed here, the version hash is checked by the
+ * parallel blob checks during block validation.
+ */
+struct NEVMDataBlobFormatter
+{
+    template<typename Stream>
+    void Ser(Stream& s, const NEVMDataBlobRef& blob)
+    {
+        if (blob) {
+            s << *blob;
+        } else {
+            WriteCompactSize(s, 0);
+        }
+    }
+    template<typename Stream>
+    void Unser(Stream& s, NEVMDataBlobRef& blob)
+    {
+        auto vch = std::make_shared<std::vector<uint8_t>>();
+        const size_t nSize = ReadCompactSize(s);
+        // don't trust the size prefix for more than a maximum sized blob up front
+        vch->reserve(std::min<size_t>(nSize, MAX_NEVM_DATA_BLOB));
+        for (size_t nPos = 0; nPos < nSize;) {
+            const size_t nChunk = std::min(nSize - nPos, NEVM_DATA_READ_CHUNK_SIZE);
+            vch->resize(nPos + nChunk);
+            const Span<uint8_t> chunk = Span<uint8_t>{*vch}.subspan(nPos, nChunk);
+            s.read(AsWritableBytes(chunk));
+            nPos += nChunk;
+        }
+        blob = std::move(vch);
+    }
+};
 class CNEVMData {
 public:
     std::vector<uint8_t> vchVersionHash;
     uint8_t nVersionHashType{NEVM_DATA_LEGACY_VERSION_BYTE};
     uint256 txid;
-    std::shared_ptr<const std::vector<uint8_t>> vchNEVMData;
+    NEVMDataBlobRef vchNEVMData;
     CNEVMData() {
         SetNull();
     }
@@ -470,9 +508,7 @@ public:
         }
         const bool fAllowPoDA = (s.GetVersion() & SERIALIZE_TRANSACTION_PODA);
         if(fAllowPoDA) {
-            std::vector<uint8_t> vchNEVMDataIn;
-            s >> vchNEVMDataIn;
-            vchNEVMData = std::make_shared<const std::vector<uint8_t>>(vchNEVMDataIn);
+            s >> Using<NEVMDataBlobFormatter>(vchNEVMData);
         }
     }
     inline void SetNull() { ClearData(); }
@@ -487,7 +523,7 @@ class MapPoDAPayloadMeta {
         uint256 txid;
         uint32_t nSize{0};
         int64_t nMedianTime{0};
-        std::shared_ptr<const std::vector<uint8_t>> vchNEVMData;
+        NEVMDataBlobRef vchNEVMData;
         MapPoDAPayloadMeta(){}
         MapPoDAPayloadMeta(const uint256 &txidIn, const uint32_t &nSizeIn, const int64_t &nMedianTimeIn): txid(txidIn), nSize(nSizeIn), nMedianTime(nMedianTimeIn) {}
         explicit MapPoDAPayloadMeta(const CNEVMData &data, const int64_t &nMedianTimeIn): txid(data.txid), nMedianTime(nMedianTimeIn) {
@@ -510,7 +546,7 @@ public:
     CScript scriptPubKey;
     // SYSCOIN
     CAssetCoinInfo assetInfo;
-    std::vector<uint8_t> vchNEVMData;
+    NEVMDataBlobRef vchNEVMData;
     CTxOut()
     {
         SetNull();
@@ -518,15 +554,15 @@ public:
     // SYSCOIN
     CTxOut(const CAmount& nValueIn, const CScript &scriptPubKeyIn);
     CTxOut(const CAmount& nValueIn, const CScript &scriptPubKeyIn, const CAssetCoinInfo &assetInfoIn) : nValue(nValueIn), scriptPubKey(scriptPubKeyIn), assetInfo(assetInfoIn) {}
-    CTxOut(const CAmount& nValueIn, const CScript &scriptPubKeyIn, const std::vector<uint8_t> &vchNEVMDataIn)  : nValue(nValueIn), scriptPubKey(scriptPubKeyIn), vchNEVMData(vchNEVMDataIn) {}
+    CTxOut(const CAmount& nValueIn, const CScript &scriptPubKeyIn, const NEVMDataBlobRef &vchNEVMDataIn)  : nValue(nValueIn), scriptPubKey(scriptPubKeyIn), vchNEVMData(vchNEVMDataIn) {}
     SERIALIZE_METHODS(CTxOut, obj)
     {
         READWRITE(obj.nValue, obj.scriptPubKey);
         if (obj.scriptPubKey.IsUnspendable() && IsSyscoinNEVMDataTx(s.GetTxVersion())) {
             if (!(s.GetType() & SER_NO_PODA) && s.GetType() & SER_NETWORK) {
-                READWRITE(obj.vchNEVMData);
+                READWRITE(Using<NEVMDataBlobFormatter>(obj.vchNEVMData));
             } else if(s.GetType() == SER_SIZE) {
-                s.seek(obj.vchNEVMData.size() * NEVM_DATA_SCALE_FACTOR);
+                s.seek(obj.GetNEVMDataSize() * NEVM_DATA_SCALE_FACTOR);
             }
         }
     }
@@ -536,20 +572,24 @@ public:
         assetInfo.SetNull();
         nValue = -1;
         scriptPubKey.clear();
-        vchNEVMData.clear();
+        vchNEVMData.reset();
     }
 
     bool IsNull() const
     {
         return (nValue == -1);
     }
+    // SYSCOIN
+    size_t GetNEVMDataSize() const { return vchNEVMData ? vchNEVMData->size() : 0; }
+    bool HasNEVMData() const { return GetNEVMDataSize() > 0; }
 
     friend bool operator==(const CTxOut& a, const CTxOut& b)
     {
         return (a.nValue       == b.nValue &&
                 a.scriptPubKey == b.scriptPubKey &&
                 a.assetInfo    == b.assetInfo &&
-                a.vchNEVMData  == b.vchNEVMData);
+                (a.vchNEVMData == b.vchNEVMData || (!a.HasNEVMData() && !b.HasNEVMData()) ||
+                 (a.HasNEVMData() && b.HasNEVMData() && *a.vchNEVMData == *b.vchNEVMData)));
     }
 
     friend bool operator!=(const CTxOut& a, const CTxOut& b)
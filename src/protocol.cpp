@@ -72,6 +72,9 @@ const char *GETCLSIG="getclsig";
 const char *BTCCSIG="btccsig";
 const char *GETBTCCSIG="getbtccsig";
 const char *MNAUTH="mnauth";
+const char *SENDPODABLOB="sendpodablob";
+const char *GETPODABLOBS="getpodablobs";
+const char *PODABLOBS="podablobs";
 } // namespace NetMsgType
 
 /** All known message types. Keep this in the same order as the list of
@@ -131,6 +134,9 @@ const static std::vector<std::string> g_all_net_message_types{
     NetMsgType::BTCCSIG,
     NetMsgType::GETBTCCSIG,
     NetMsgType::MNAUTH,  
+    NetMsgType::SENDPODABLOB,
+    NetMsgType::GETPODABLOBS,
+    NetMsgType::PODABLOBS,
     NetMsgType::GETCFILTERS,
     NetMsgType::CFILTER,
     NetMsgType::GETCFHEADERS,
@@ -284,6 +284,22 @@ extern const char *GETCLSIG;
 extern const char *BTCCSIG;
 extern const char *GETBTCCSIG;
 extern const char *MNAUTH;
+/**
+ * The sendpodablob message indicates that a node strips PoDA blobs from blocktxn
+ * messages it sends and accepts stripped ones, fetching blobs it does not have
+ * with getpodablobs.
+ * Must be sent between VERSION and VERACK.
+ */
+extern const char *SENDPODABLOB;
+/**
+ * Requests PoDA blobs by version hash for a block being reconstructed from
+ * a compact block.
+ */
+extern const char *GETPODABLOBS;
+/**
+ * Contains the PoDA blobs asked for by a getpodablobs message.
+ */
+extern const char *PODABLOBS;
 /**
  * Contains a 4-byte version number and an 8-byte salt.
  * The salt is used to compute short txids needed for efficient
@@ -6,6 +6,7 @@
 
 #include <arith_uint256.h>
 #include <auxpow.h>
+#include <auxpowtag.h>
 #include <chainparams.h>
 #include <common/args.h>
 #include <common/run_command.h>
@@ -323,15 +324,9 @@ AuxpowMiner::lookupSavedBlock (const std::string& hashHex) const
 // SYSCOIN
 const CScript AuxpowMiner::createScriptPubKey(const uint256& auxRoot, int height)
 {
-  CScript sysCommitScript;
-  CDataStream ssData(SER_NETWORK, PROTOCOL_VERSION);
-  ssData << pchSyscoinHeader;
-  ssData << auxRoot;
-  ssData << static_cast<uint32_t>(height);
-
   // Build OP_RETURN output script
-  const auto bytesVec = MakeUCharSpan(ssData);
-  sysCommitScript << OP_RETURN << std::vector<unsigned char>(bytesVec.begin(), bytesVec.end());
+  CScript sysCommitScript;
+  sysCommitScript << OP_RETURN << EncodeSyscoinAuxpowTag(auxRoot, static_cast<uint32_t>(height));
   return sysCommitScript;
 }
 
@@ -5,6 +5,7 @@
 
 #include <rpc/blockchain.h>
 
+#include <auxpowtag.h>
 #include <blockfilter.h>
 #include <chain.h>
 #include <chainparams.h>
@@ -144,6 +145,16 @@ UniValue AuxpowToJSON(const CAuxPow& auxpow, Chainstate& chainstate)
     const std::string strHex = HexStr(ssParent);
     result.pushKV("parentblock", strHex);
 
+    for (const SyscoinAuxpowTag& sysTag : ScanSyscoinAuxpowTags(*auxpow.coinbaseTx)) {
+        if (!sysTag.fComplete) continue;
+        UniValue tag(UniValue::VOBJ);
+        tag.pushKV("output", (uint64_t)sysTag.nOutput);
+        tag.pushKV("blockhash", sysTag.hash.GetHex());
+        tag.pushKV("height", (uint64_t)sysTag.nHeight);
+        result.pushKV("syscointag", tag);
+        break;
+    }
+
     return result;
 }
 static const CBlockIndex* ParseHashOrHeight(const UniValue& param, ChainstateManager& chainman) {
@@ -926,6 +937,12 @@ static RPCHelpMan getblock()
                         {RPCResult::Type::ARR, "chainmerklebranch", "Branch's in the auxpow Merkle tree",
                             {{RPCResult::Type::STR_HEX, "", "auxpow branch"}}},
                         {RPCResult::Type::STR_HEX, "parentblock", "The parent block serialised as hex string"},
+                        {RPCResult::Type::OBJ, "syscointag", /*optional=*/true, "The Syscoin tag committed in the parent coinbase",
+                        {
+                            {RPCResult::Type::NUM, "output", "Index of the parent coinbase output carrying the tag"},
+                            {RPCResult::Type::STR_HEX, "blockhash", "The referenced Syscoin block hash"},
+                            {RPCResult::Type::NUM, "height", "The referenced Syscoin block height"},
+                        }},
                     }},
                     {RPCResult::Type::STR_HEX, "previousblockhash", /*optional=*/true, "The hash of the previous block (if available)"},
                     {RPCResult::Type::STR_HEX, "nextblockhash", /*optional=*/true, "The hash of the next block (if available)"},
@@ -77,7 +77,7 @@ static RPCHelpMan sendrawtransaction()
                 if(nevmData.vchNEVMData && nevmData.vchNEVMData->size() > 0) {
                     auto nOut = GetSyscoinDataOutput(mtx);
                     if (nOut != -1) {
-                        mtx.vout[nOut].vchNEVMData = *nevmData.vchNEVMData;
+                        mtx.vout[nOut].vchNEVMData = nevmData.vchNEVMData;
                     }
                     // we stuffed the data in the data script but it was signed without so clear data so signed tx can succeed
                     std::vector<unsigned char> data;
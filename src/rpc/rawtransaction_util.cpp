@@ -113,8 +113,8 @@ void AddOutputs(CMutableTransaction& rawTx, const UniValue& outputs_in)
             CTxOut out(nAmount, CScript() << OP_RETURN << data);
             // SYSCOIN
             if(outputs.exists("datanevm")) {
-                out.vchNEVMData = ParseHexV(outputs["datanevm"].getValStr(), "DataNEVM");
-                if (out.vchNEVMData.size() > MAX_NEVM_DATA_BLOB) {
+                out.vchNEVMData = std::make_shared<const std::vector<uint8_t>>(ParseHexV(outputs["datanevm"].getValStr(), "DataNEVM"));
+                if (out.GetNEVMDataSize() > MAX_NEVM_DATA_BLOB) {
                     throw JSONRPCError(RPC_INVALID_PARAMETER, "datanevm exceeds max size (2MB)");
                 }
             }
@@ -19,6 +19,8 @@
 #include <llmq/quorums_chainlocks.h>
 #include <llmq/quorums_btccheckpoints.h>
 #include <llmq/quorums_utils.h>
+#include <llmq/quorums_init.h>
+#include <bls/bls_worker.h>
 #include <rpc/util.h>
 #include <net.h>
 #include <rpc/blockchain.h>
@@ -818,6 +820,56 @@ static RPCHelpMan submitchainlock()
     };
 }
 
+static RPCHelpMan quorum_blsworkerstats()
+{
+    return RPCHelpMan{"quorum_blsworkerstats",
+        "\nReturn the queue wait statistics of the BLS worker, per priority lane.\n",
+        {},
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::NUM, "threads", "Number of worker threads"},
+                {RPCResult::Type::OBJ_DYN, "lanes", "Statistics per lane, from most to least urgent",
+                {
+                    {RPCResult::Type::OBJ, "lane", "",
+                    {
+                        {RPCResult::Type::NUM, "jobs", "Jobs picked up by a worker since startup"},
+                        {RPCResult::Type::NUM, "queued", "Jobs currently waiting for a worker"},
+                        {RPCResult::Type::NUM, "avg_wait_us", "Average time jobs waited for a worker, in microseconds"},
+                        {RPCResult::Type::NUM, "max_wait_us", "Maximum time a job waited for a worker, in microseconds"},
+                    }},
+                }},
+            }},
+        RPCExamples{
+                HelpExampleCli("quorum_blsworkerstats", "")
+            + HelpExampleRpc("quorum_blsworkerstats", "")
+        },
+    [&](const RPCHelpMan& self, const node::JSONRPCRequest& request) -> UniValue
+{
+    if (!llmq::blsWorker) {
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "BLS worker not initialized");
+    }
+
+    const auto stats = llmq::blsWorker->GetLaneStats();
+    UniValue lanes(UniValue::VOBJ);
+    for (size_t i = 0; i < stats.size(); i++) {
+        const auto& laneStats = stats[i];
+        UniValue obj(UniValue::VOBJ);
+        obj.pushKV("jobs", laneStats.nJobs);
+        obj.pushKV("queued", (uint64_t)laneStats.nQueued);
+        obj.pushKV("avg_wait_us", laneStats.nJobs ? laneStats.nTotalWaitUs / (int64_t)laneStats.nJobs : 0);
+        obj.pushKV("max_wait_us", laneStats.nMaxWaitUs);
+        lanes.pushKV(BLSWorkerLaneToString(static_cast<BLSWorkerLane>(i)), obj);
+    }
+
+    UniValue ret(UniValue::VOBJ);
+    ret.pushKV("threads", (uint64_t)llmq::blsWorker->GetWorkerCount());
+    ret.pushKV("lanes", lanes);
+    return ret;
+},
+    };
+}
+
 void RegisterQuorumsRPCCommands(CRPCTable &t)
 {
     static const CRPCCommand commands[] =
@@ -828,6 +880,7 @@ void RegisterQuorumsRPCCommands(CRPCTable &t)
         {"evo", &quorum_memberof},
         {"evo", &quorum_selectquorum},
         {"evo", &quorum_dkgsimerror},
+        {"evo", &quorum_blsworkerstats},
         {"evo", &quorum_hasrecsig},
         {"evo", &quorum_verify},
         {"evo", &quorum_getrecsig},
@@ -17,11 +17,79 @@
 #include <logging.h>
 #include <core_io.h>
 
+#include <cuckoocache.h>
+#include <memusage.h>
+#include <random.h>
+
 #include <algorithm>
+#include <shared_mutex>
 #include <unordered_set>
 
 std::unique_ptr<CNEVMTxRootsDB> pnevmtxrootsdb;
 std::unique_ptr<CNEVMMintedTxDB> pnevmtxmintdb;
+namespace {
+/**
+ * Valid mint proof cache, so the Merkle-Patricia proofs of a mint accepted into
+ * the memory pool are not verified again when the block containing it connects.
+ */
+class CMintProofCache
+{
+private:
+    //! Entries are SHA256(nonce || 'M' || 31 zero bytes || txid || canonical flag || vault manager address).
+    //! The txid commits to the NEVM block hash, tx path, both roots and the proof nodes themselves.
+    CSHA256 m_salted_hasher;
+    typedef CuckooCache::cache<uint256, SignatureCacheHasher> map_type;
+    map_type setValid;
+    std::shared_mutex cs_mintproofcache;
+
+public:
+    CMintProofCache()
+    {
+        uint256 nonce = GetRandHash();
+        static constexpr unsigned char PADDING_MINT[32] = {'M'};
+        m_salted_hasher.Write(nonce.begin(), 32);
+        m_salted_hasher.Write(PADDING_MINT, 32);
+    }
+
+    void
+    ComputeEntry(uint256& entry, const uint256& txid, const bool fBridgeCanonicalActive, const std::vector<unsigned char>& vchManagerAddress) const
+    {
+        const unsigned char fCanonical = fBridgeCanonicalActive ? 1 : 0;
+        CSHA256 hasher = m_salted_hasher;
+        hasher.Write(txid.begin(), 32).Write(&fCanonical, 1).Write(vchManagerAddress.data(), vchManagerAddress.size()).Finalize(entry.begin());
+    }
+
+    bool
+    Get(const uint256& entry, const bool erase)
+    {
+        std::shared_lock<std::shared_mutex> lock(cs_mintproofcache);
+        return setValid.contains(entry, erase);
+    }
+
+    void Set(const uint256& entry)
+    {
+        std::unique_lock<std::shared_mutex> lock(cs_mintproofcache);
+        setValid.insert(entry);
+    }
+    std::optional<std::pair<uint32_t, size_t>> setup_bytes(size_t n)
+    {
+        return setValid.setup_bytes(n);
+    }
+};
+
+static CMintProofCache mintProofCache;
+} // namespace
+
+bool InitMintProofCache(size_t max_size_bytes)
+{
+    auto setup_results = mintProofCache.setup_bytes(max_size_bytes);
+    if (!setup_results) return false;
+
+    const auto [num_elems, approx_size_bytes] = *setup_results;
+    LogPrintf("Using %zu MiB out of %zu MiB requested for mint proof cache, able to store %zu elements\n",
+              approx_size_bytes >> 20, max_size_bytes >> 20, num_elems);
+    return true;
+}
 const arith_uint256 nMax = arith_uint256(MAX_MONEY);
 
 static bool GetCanonicalSyscoinData(const CScript& script, std::vector<unsigned char>& data)
@@ -127,6 +195,163 @@ static bool ReadABIUint64(
     return true;
 }
 
+// Inclusive cutover: below H prove legacy vault; at/above H prove V2 vault.
+// Uses nBridgeV2StartBlock (not nCLReceiptStartBlock) so canonical receipt
+// hardening can remain active while V2 is still undeployed.
+static const std::vector<unsigned char>& GetVaultManagerAddress(const uint32_t nHeight)
+{
+    const Consensus::Params& consensus = Params().GetConsensus();
+    return nHeight < (uint32_t)consensus.nBridgeV2StartBlock
+            ? consensus.vchSyscoinVaultManagerLegacy
+            : consensus.vchSyscoinVaultManager;
+}
+
+CMintProofCheck::CMintProofCheck(const CMintSyscoin& mintSyscoinIn, const bool fBridgeCanonicalActiveIn, const uint32_t nHeightIn, NEVMTrieNodeCache* pnodeCacheIn) :
+    mintSyscoin(&mintSyscoinIn), fBridgeCanonicalActive(fBridgeCanonicalActiveIn), nHeight(nHeightIn), pnodeCache(pnodeCacheIn) { }
+
+CMintProofCheck::CMintProofCheck(std::shared_ptr<const CMintSyscoin> mintSyscoinIn, const bool fBridgeCanonicalActiveIn, const uint32_t nHeightIn, NEVMTrieNodeCache* pnodeCacheIn, const uint256& cacheEntryIn, const bool fCacheStoreIn) :
+    mintSyscoin(mintSyscoinIn.get()), mintSyscoinOwner(std::move(mintSyscoinIn)), fBridgeCanonicalActive(fBridgeCanonicalActiveIn), nHeight(nHeightIn), pnodeCache(pnodeCacheIn), cacheEntry(cacheEntryIn), fCacheStore(fCacheStoreIn) { }
+
+bool CMintProofCheck::VerifyProofs(std::string& strError) {
+    dev::RLPStream sTxRoot, sReceiptRoot;
+    sTxRoot.append(dev::bytesConstRef(mintSyscoin->nTxRoot.data(), mintSyscoin->nTxRoot.size()));
+    sReceiptRoot.append(dev::bytesConstRef(mintSyscoin->nReceiptRoot.data(), mintSyscoin->nReceiptRoot.size()));
+    const dev::RLP rlpTxRoot(sTxRoot.out());
+    const dev::RLP rlpReceiptRoot(sReceiptRoot.out());
+    const dev::RLP rlpTxParentNodes(&mintSyscoin->vchTxParentNodes);
+    const dev::RLP rlpReceiptParentNodes(&mintSyscoin->vchReceiptParentNodes);
+    const dev::RLP rlpReceiptValue(
+        dev::bytesConstRef(
+            mintSyscoin->vchReceiptParentNodes.data() + mintSyscoin->posReceipt,
+            mintSyscoin->vchReceiptParentNodes.size() - mintSyscoin->posReceipt
+        )
+    );
+    const dev::RLP rlpTxValue(
+        dev::bytesConstRef(
+            mintSyscoin->vchTxParentNodes.data() + mintSyscoin->posTx,
+            mintSyscoin->vchTxParentNodes.size() - mintSyscoin->posTx
+        )
+    );
+    const dev::bytesConstRef vchTxPathRef(mintSyscoin->vchTxPath.data(), mintSyscoin->vchTxPath.size());
+
+    std::optional<uint8_t> receiptEnvelopeType;
+    if (!VerifyProof(vchTxPathRef, rlpReceiptValue, rlpReceiptParentNodes,
+                     rlpReceiptRoot, &receiptEnvelopeType, pnodeCache)) {
+        strError = "mint-verify-receipt-proof";
+        return false;
+    }
+    if (!VerifyProof(vchTxPathRef, rlpTxValue, rlpTxParentNodes,
+                     rlpTxRoot, &txEnvelopeType, pnodeCache)) {
+        strError = "mint-verify-tx-proof";
+        return false;
+    }
+    // Before activation, type 0x7f failed proof matching under the historical
+    // exclusive-bound parser. Preserve that rejection while using the correct
+    // inclusive EIP-2718 decoder.
+    if (!fBridgeCanonicalActive &&
+        ((receiptEnvelopeType.has_value() && *receiptEnvelopeType == 0x7f) ||
+         (txEnvelopeType.has_value() && *txEnvelopeType == 0x7f))) {
+        strError = "mint-unsupported-tx-format";
+        return false;
+    }
+    if (fBridgeCanonicalActive && receiptEnvelopeType != txEnvelopeType) {
+        strError = "mint-envelope-type-mismatch";
+        return false;
+    }
+    return true;
+}
+
+bool CMintProofCheck::CheckTxValue(std::string& strError) const {
+    const dev::RLP rlpTxValue(
+        dev::bytesConstRef(
+            mintSyscoin->vchTxParentNodes.data() + mintSyscoin->posTx,
+            mintSyscoin->vchTxParentNodes.size() - mintSyscoin->posTx
+        )
+    );
+    if (!rlpTxValue.isList()) {
+        strError = "mint-tx-rlp-list";
+        return false;
+    }
+    const size_t txItemCount = rlpTxValue.itemCount();
+    if (txItemCount < 8) {
+        strError = "mint-tx-itemcount";
+        return false;
+    }
+
+    dev::u256 nChainID = 0;
+    size_t toFieldIndex;
+    if (fBridgeCanonicalActive) {
+        if (!txEnvelopeType.has_value()) {
+            if (txItemCount != 9) {
+                strError = "mint-invalid-legacy-tx-format";
+                return false;
+            }
+            const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
+            if (v >= 35) {
+                nChainID = (v - 35) / 2;
+            }
+            toFieldIndex = 3;
+        } else if (*txEnvelopeType == 1 && txItemCount == 11) {
+            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
+            toFieldIndex = 4;
+        } else if (*txEnvelopeType == 2 && txItemCount == 12) {
+            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
+            toFieldIndex = 5;
+        } else {
+            strError = "mint-unsupported-tx-format";
+            return false;
+        }
+    } else if (txItemCount == 9) {
+        const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
+        if (v >= 35) {
+            nChainID = (v - 35) / 2;
+        }
+        toFieldIndex = 3;
+    } else if (txItemCount >= 12) {
+        nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
+        toFieldIndex = 5;
+    } else {
+        strError = "mint-unsupported-tx-format";
+        return false;
+    }
+    
+    // Compare extracted chain ID with Syscoin's expected Chain ID
+    if(nChainID != (dev::u256(Params().GetConsensus().nNEVMChainID))) {
+        strError = "mint-invalid-chainid";
+        return false;
+    }
+    dev::bytes vchAddress = rlpTxValue[toFieldIndex].toBytes(dev::RLP::VeryStrict);
+    if (vchAddress.size() != 20) {
+        strError = "mint-invalid-address-length";
+        return false;
+    }
+    const dev::Address address160(vchAddress);
+    // Verify "to" address matches the height-selected vault manager.
+    if (GetVaultManagerAddress(nHeight) != address160.asBytes()) {
+        strError = "mint-invalid-contract-manager";
+        return false;
+    }
+    return true;
+}
+
+bool CMintProofCheck::operator()() noexcept {
+    std::string strError;
+    try {
+        if (VerifyProofs(strError) && CheckTxValue(strError)) {
+            if (fCacheStore) {
+                mintProofCache.Set(cacheEntry);
+            }
+            return true;
+        }
+    } catch (const std::exception& e) {
+        strError = e.what();
+    } catch (...) {
+        strError = "mint-proof-check-exception";
+    }
+    LogPrint(BCLog::SYS, "CMintProofCheck: mint %s failed: %s\n", mintSyscoin->nTxHash.GetHex(), strError);
+    return false;
+}
+
 bool CheckSyscoinMintInternal(
     const CMintSyscoin &mintSyscoin,
     TxValidationState &state,
@@ -136,7 +361,10 @@ bool CheckSyscoinMintInternal(
     NEVMMintTxSet &setMintTxs,
     uint64_t &nAssetFromLog,
     CAmount &outputAmount,
-    std::string &witnessAddress) {
+    std::string &witnessAddress,
+    const bool fSkipProofChecks,
+    NEVMTrieNodeCache* pnodeCache,
+    const bool fReplayChecked) {
     NEVMTxRoot txRootDB;
     if (!pnevmtxrootsdb || !pnevmtxrootsdb->ReadTxRoots(mintSyscoin.nBlockHash, txRootDB)) {
         return FormatSyscoinErrorMessage(state, "mint-txroot-missing", fJustCheck);
@@ -154,13 +382,6 @@ bool CheckSyscoinMintInternal(
         return FormatSyscoinErrorMessage(state, "mint-invalid-receipt-position", fJustCheck);
     }
 
-    dev::RLPStream sTxRoot, sReceiptRoot;
-    sTxRoot.append(dev::bytesConstRef(mintSyscoin.nTxRoot.data(), mintSyscoin.nTxRoot.size()));
-    sReceiptRoot.append(dev::bytesConstRef(mintSyscoin.nReceiptRoot.data(), mintSyscoin.nReceiptRoot.size()));
-    const dev::RLP rlpTxRoot(sTxRoot.out());
-    const dev::RLP rlpReceiptRoot(sReceiptRoot.out());
-    const dev::RLP rlpTxParentNodes(&mintSyscoin.vchTxParentNodes);
-    const dev::RLP rlpReceiptParentNodes(&mintSyscoin.vchReceiptParentNodes);
     const dev::bytesConstRef vchTxValueRef(
         mintSyscoin.vchTxParentNodes.data() + mintSyscoin.posTx,
         mintSyscoin.vchTxParentNodes.size() - mintSyscoin.posTx
@@ -171,8 +392,6 @@ bool CheckSyscoinMintInternal(
             mintSyscoin.vchReceiptParentNodes.size() - mintSyscoin.posReceipt
         )
     );
-    const dev::RLP rlpTxValue(vchTxValueRef);
-    const dev::bytesConstRef vchTxPathRef(mintSyscoin.vchTxPath.data(), mintSyscoin.vchTxPath.size());
 
     const dev::h256 txHash = dev::sha3(vchTxValueRef);
     std::vector<unsigned char> vchTxHash(txHash.asBytes());
@@ -181,32 +400,23 @@ bool CheckSyscoinMintInternal(
         return FormatSyscoinErrorMessage(state, "mint-verify-tx-hash", fJustCheck);
     }
     // A positive replay lookup can reject before the expensive MPT proofs. A
-    // negative lookup never authorizes the mint.
-    if (pnevmtxmintdb->ExistsTx(mintSyscoin.nTxHash)) {
+    // negative lookup never authorizes the mint. ConnectBlock looks up all mints of a block at once.
+    if (!fReplayChecked && pnevmtxmintdb->ExistsTx(mintSyscoin.nTxHash)) {
         return FormatSyscoinErrorMessage(state, "mint-exists", fJustCheck);
     }
 
-    std::optional<uint8_t> receiptEnvelopeType;
-    std::optional<uint8_t> txEnvelopeType;
-    if (!VerifyProof(vchTxPathRef, rlpReceiptValue, rlpReceiptParentNodes,
-                     rlpReceiptRoot, &receiptEnvelopeType)) {
-        return FormatSyscoinErrorMessage(state, "mint-verify-receipt-proof", fJustCheck);
-    }
-    if (!VerifyProof(vchTxPathRef, rlpTxValue, rlpTxParentNodes,
-                     rlpTxRoot, &txEnvelopeType)) {
-        return FormatSyscoinErrorMessage(state, "mint-verify-tx-proof", fJustCheck);
-    }
-    // Before activation, type 0x7f failed proof matching under the historical
-    // exclusive-bound parser. Preserve that rejection while using the correct
-    // inclusive EIP-2718 decoder.
-    if (!fBridgeCanonicalActive &&
-        ((receiptEnvelopeType.has_value() && *receiptEnvelopeType == 0x7f) ||
-         (txEnvelopeType.has_value() && *txEnvelopeType == 0x7f))) {
-        return FormatSyscoinErrorMessage(state, "mint-unsupported-tx-format", fJustCheck);
-    }
-    if (fBridgeCanonicalActive && receiptEnvelopeType != txEnvelopeType) {
-        return FormatSyscoinErrorMessage(state, "mint-envelope-type-mismatch", fJustCheck);
+    // The Merkle-Patricia proofs and the tx fields they authenticate are the expensive
+    // part, the caller skips them when they are cached or queued to run next to the script checks
+    CMintProofCheck proofCheck(mintSyscoin, fBridgeCanonicalActive, nHeight, pnodeCache);
+    std::string strProofError;
+    if (!fSkipProofChecks && !proofCheck.VerifyProofs(strProofError)) {
+        return FormatSyscoinErrorMessage(state, strProofError, fJustCheck);
     }
+    // When the proofs are queued, the receipt and log checks below run before them on values the
+    // proofs have not authenticated yet. That is safe because they only reject or record the mint in
+    // this block's setMintTxs: ConnectBlock waits on the mint queue before it accepts the block, and a
+    // failed proof rejects it there along with everything recorded. The only effect of running them
+    // first is which reject reason a block with both bad proofs and a bad receipt reports.
 
     if (!rlpReceiptValue.isList() || rlpReceiptValue.itemCount() != 4) {
         return FormatSyscoinErrorMessage(state, "mint-invalid-receipt-structure", fJustCheck);
@@ -221,15 +431,8 @@ bool CheckSyscoinMintInternal(
     if (!rlpLogs.isList() || itemCount < 1 || itemCount > 10) {
         return FormatSyscoinErrorMessage(state, "mint-invalid-receipt-logs-count", fJustCheck);
     }
-    const Consensus::Params& consensus = Params().GetConsensus();
-    // Inclusive cutover: below H prove legacy vault; at/above H prove V2 vault.
-    // Uses nBridgeV2StartBlock (not nCLReceiptStartBlock) so canonical receipt
-    // hardening can remain active while V2 is still undeployed.
-    const std::vector<unsigned char>& vchManagerAddress =
-        nHeight < (uint32_t)consensus.nBridgeV2StartBlock
-            ? consensus.vchSyscoinVaultManagerLegacy
-            : consensus.vchSyscoinVaultManager;
-    const std::vector<unsigned char>& vchFreezeTopic = consensus.vchTokenFreezeMethod;
+    const std::vector<unsigned char>& vchManagerAddress = GetVaultManagerAddress(nHeight);
+    const std::vector<unsigned char>& vchFreezeTopic = Params().GetConsensus().vchTokenFreezeMethod;
 
     for (size_t i = 0; i < itemCount; ++i) {
         nAssetFromLog = 0;
@@ -352,61 +555,8 @@ bool CheckSyscoinMintInternal(
             return state.Invalid(TxValidationResult::TX_MINT_DUPLICATE, "mint-duplicate-transfer");
         }
     }
-    
-    if (!rlpTxValue.isList()) {
-        return FormatSyscoinErrorMessage(state, "mint-tx-rlp-list", fJustCheck);
-    }
-    const size_t txItemCount = rlpTxValue.itemCount();
-    if (txItemCount < 8) {
-        return FormatSyscoinErrorMessage(state, "mint-tx-itemcount", fJustCheck);
-    }
-
-    dev::u256 nChainID = 0;
-    size_t toFieldIndex;
-    if (fBridgeCanonicalActive) {
-        if (!txEnvelopeType.has_value()) {
-            if (txItemCount != 9) {
-                return FormatSyscoinErrorMessage(state, "mint-invalid-legacy-tx-format", fJustCheck);
-            }
-            const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
-            if (v >= 35) {
-                nChainID = (v - 35) / 2;
-            }
-            toFieldIndex = 3;
-        } else if (*txEnvelopeType == 1 && txItemCount == 11) {
-            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
-            toFieldIndex = 4;
-        } else if (*txEnvelopeType == 2 && txItemCount == 12) {
-            nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
-            toFieldIndex = 5;
-        } else {
-            return FormatSyscoinErrorMessage(state, "mint-unsupported-tx-format", fJustCheck);
-        }
-    } else if (txItemCount == 9) {
-        const dev::u256 v = rlpTxValue[6].toInt<dev::u256>(dev::RLP::VeryStrict);
-        if (v >= 35) {
-            nChainID = (v - 35) / 2;
-        }
-        toFieldIndex = 3;
-    } else if (txItemCount >= 12) {
-        nChainID = rlpTxValue[0].toInt<dev::u256>(dev::RLP::VeryStrict);
-        toFieldIndex = 5;
-    } else {
-        return FormatSyscoinErrorMessage(state, "mint-unsupported-tx-format", fJustCheck);
-    }
-    
-    // Compare extracted chain ID with Syscoin's expected Chain ID
-    if(nChainID != (dev::u256(Params().GetConsensus().nNEVMChainID))) {
-        return FormatSyscoinErrorMessage(state, "mint-invalid-chainid", fJustCheck);
-    }
-    dev::bytes vchAddress = rlpTxValue[toFieldIndex].toBytes(dev::RLP::VeryStrict);
-    if (vchAddress.size() != 20) {
-        return FormatSyscoinErrorMessage(state, "mint-invalid-address-length", fJustCheck);
-    }
-    const dev::Address address160(vchAddress);
-    // Verify "to" address matches the height-selected vault manager.
-    if (vchManagerAddress != address160.asBytes()) {
-        return FormatSyscoinErrorMessage(state, "mint-invalid-contract-manager", fJustCheck);
+    if (!fSkipProofChecks && !proofCheck.CheckTxValue(strProofError)) {
+        return FormatSyscoinErrorMessage(state, strProofError, fJustCheck);
     }
     
     return true;
@@ -419,11 +569,26 @@ bool CheckSyscoinMint(
     const bool &fJustCheck,
     NEVMMintTxSet &setMintTxs,
     CAssetsMap &mapAssetIn,
-    CAssetsMap &mapAssetOut
+    CAssetsMap &mapAssetOut,
+    const bool fCacheStore,
+    std::vector<CMintProofCheck>* pvMintChecks,
+    NEVMTrieNodeCache* pnodeCache,
+    const NEVMMintParsedMap* pmapParsedMints
 ) {
     LogPrint(BCLog::SYS,"*** ASSET MINT blockHeight=%d tx=%s %s\n",
             nHeight, txHash.ToString(), fJustCheck ? "JUSTCHECK" : "BLOCK");
-    const CMintSyscoin mintSyscoin(tx);
+    std::shared_ptr<const CMintSyscoin> pmintSyscoin;
+    if (pmapParsedMints) {
+        const auto it = pmapParsedMints->find(txHash);
+        if (it != pmapParsedMints->end()) {
+            pmintSyscoin = it->second;
+        }
+    }
+    const bool fReplayChecked{pmintSyscoin != nullptr};
+    if (!pmintSyscoin) {
+        pmintSyscoin = std::make_shared<const CMintSyscoin>(tx);
+    }
+    const CMintSyscoin& mintSyscoin = *pmintSyscoin;
     if (mintSyscoin.IsNull()) {
         return FormatSyscoinErrorMessage(state, "mint-unserialize-failed", fJustCheck);
     }
@@ -432,8 +597,12 @@ bool CheckSyscoinMint(
     CAmount outputAmount;
     const bool fBridgeCanonicalActive =
         nHeight >= (uint32_t)Params().GetConsensus().nCLReceiptStartBlock;
+    // like the signature cache, blocks consult but don't populate the cache and erase what they hit
+    uint256 cacheEntry;
+    mintProofCache.ComputeEntry(cacheEntry, txHash, fBridgeCanonicalActive, GetVaultManagerAddress(nHeight));
+    const bool fProofCached = mintProofCache.Get(cacheEntry, !fCacheStore);
     if(!CheckSyscoinMintInternal(mintSyscoin, state, fJustCheck, fBridgeCanonicalActive,
-                                nHeight, setMintTxs, nAssetFromLog, outputAmount, witnessAddress)) {
+                                nHeight, setMintTxs, nAssetFromLog, outputAmount, witnessAddress, fProofCached || pvMintChecks != nullptr, pnodeCache, fReplayChecked)) {
         return false; // state filled in by CheckSyscoinMintInternal
     }
     bool bFoundDest = false;
@@ -489,6 +658,13 @@ bool CheckSyscoinMint(
     if (outputAmount != nTotalMinted) {
         return FormatSyscoinErrorMessage(state, "mint-output-mismatch", fJustCheck);
     }
+    if (!fProofCached) {
+        if (pvMintChecks) {
+            pvMintChecks->emplace_back(pmintSyscoin, fBridgeCanonicalActive, nHeight, pnodeCache, cacheEntry, fCacheStore);
+        } else if (fCacheStore) {
+            mintProofCache.Set(cacheEntry);
+        }
+    }
     if (!fJustCheck) {
         if (nHeight > 0) {
             LogPrint(BCLog::SYS,"CONNECTED ASSET MINT: asset=%llu tx=%s height=%d fJustCheck=%s\n",
@@ -513,7 +689,7 @@ bool DisconnectMintAsset(const CTransaction &tx, NEVMMintTxSet &setMintTxs){
     return true;
 }
 
-bool CheckSyscoinInputs(const Consensus::Params& params, const CTransaction& tx, const uint256& txHash, TxValidationState& state, const uint32_t &nHeight, const bool &fJustCheck, NEVMMintTxSet &setMintTxs, CAssetsMap& mapAssetIn, CAssetsMap& mapAssetOut) {
+bool CheckSyscoinInputs(const Consensus::Params& params, const CTransaction& tx, const uint256& txHash, TxValidationState& state, const uint32_t &nHeight, const bool &fJustCheck, NEVMMintTxSet &setMintTxs, CAssetsMap& mapAssetIn, CAssetsMap& mapAssetOut, const bool fCacheStore, std::vector<CMintProofCheck>* pvMintChecks, NEVMTrieNodeCache* pnodeCache, const NEVMMintParsedMap* pmapParsedMints) {
     bool good = true;
     if(nHeight < (uint32_t)params.nNexusStartBlock)
         return !tx.HasAssets();
@@ -530,7 +706,7 @@ bool CheckSyscoinInputs(const Consensus::Params& params, const CTransaction& tx,
             }
         }
         if(IsSyscoinMintTx(tx.nVersion)) {
-            good = CheckSyscoinMint(tx, txHash, state, nHeight, fJustCheck, setMintTxs, mapAssetIn, mapAssetOut);
+            good = CheckSyscoinMint(tx, txHash, state, nHeight, fJustCheck, setMintTxs, mapAssetIn, mapAssetOut, fCacheStore, pvMintChecks, pnodeCache, pmapParsedMints);
         }
         else if (IsAssetAllocationTx(tx.nVersion)) {
             good = CheckAssetAllocationInputs(tx, txHash, state, nHeight, fJustCheck, mapAssetIn, mapAssetOut);
@@ -634,9 +810,54 @@ bool CheckAssetAllocationInputs(const CTransaction &tx, const uint256& txHash, T
 }
 // called on connect
 
+CNEVMTxRootsDB::CNEVMTxRootsDB(const DBParams& params, size_t nMaxReadCacheBytesIn) : CDBWrapper(params), nMaxReadCacheBytes(nMaxReadCacheBytesIn) {}
+
+bool CNEVMTxRootsDB::FindCached(const uint256& nBlockHash, NEVMTxRoot& txRoot) const {
+    auto it = mapCache.find(nBlockHash);
+    if (it != mapCache.end()) {
+        txRoot = it->second;
+        return true;
+    }
+    auto itRead = mapReadCache.find(nBlockHash);
+    if (itRead != mapReadCache.end()) {
+        itRead->second.fReferenced.store(true, std::memory_order_relaxed);
+        txRoot = itRead->second.txRoot;
+        return true;
+    }
+    return false;
+}
+size_t CNEVMTxRootsDB::ReadCacheUsage() const {
+    return memusage::DynamicUsage(mapReadCache) + memusage::DynamicUsage(listReadOrder);
+}
+void CNEVMTxRootsDB::AddToReadCache(const uint256& nBlockHash, const NEVMTxRoot& txRoot) {
+    if (mapCache.count(nBlockHash)) return;
+    auto [it, inserted] = mapReadCache.try_emplace(nBlockHash);
+    it->second.txRoot = txRoot;
+    if (!inserted) return;
+    listReadOrder.push_front(nBlockHash);
+    it->second.itOrder = listReadOrder.begin();
+    // referenced entries move back to the front once, so this visits each entry at most twice
+    while (!listReadOrder.empty() && ReadCacheUsage() > nMaxReadCacheBytes) {
+        auto itOldest = mapReadCache.find(listReadOrder.back());
+        if (itOldest->second.fReferenced.exchange(false, std::memory_order_relaxed)) {
+            listReadOrder.splice(listReadOrder.begin(), listReadOrder, itOldest->second.itOrder);
+            continue;
+        }
+        listReadOrder.pop_back();
+        mapReadCache.erase(itOldest);
+    }
+}
+void CNEVMTxRootsDB::EraseFromReadCache(const uint256& nBlockHash) {
+    auto it = mapReadCache.find(nBlockHash);
+    if (it != mapReadCache.end()) {
+        listReadOrder.erase(it->second.itOrder);
+        mapReadCache.erase(it);
+    }
+}
 void CNEVMTxRootsDB::FlushDataToCache(const NEVMTxRootMap &mapNEVMTxRoots) {
-    LOCK(cs_cache);
+    std::unique_lock<std::shared_mutex> lock(cs_cache);
     for (const auto& entry : mapNEVMTxRoots) {
+        EraseFromReadCache(entry.first);
         auto result = mapCache.emplace(entry.first, entry.second);
         if (!result.second) {
             result.first->second = entry.second;
@@ -645,7 +866,7 @@ void CNEVMTxRootsDB::FlushDataToCache(const NEVMTxRootMap &mapNEVMTxRoots) {
 }
 bool CNEVMTxRootsDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
 {
-    LOCK(cs_cache);
+    std::unique_lock<std::shared_mutex> lock(cs_cache);
     if (mapCache.empty()) return true;
 
     CDBBatch batch(*this);
@@ -677,44 +898,192 @@ bool CNEVMTxRootsDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
 }
 
 bool CNEVMTxRootsDB::ReadTxRoots(const uint256& nBlockHash, NEVMTxRoot& txRoot) {
-    LOCK(cs_cache);
-    auto it = mapCache.find(nBlockHash);
-    if (it != mapCache.end()) {
-        txRoot = it->second;
-        return true;
+    uint64_t nEpoch;
+    {
+        std::shared_lock<std::shared_mutex> lock(cs_cache);
+        if (FindCached(nBlockHash, txRoot)) return true;
+        nEpoch = nEraseEpoch;
+    }
+    if (!Read(nBlockHash, txRoot)) return false;
+    std::unique_lock<std::shared_mutex> lock(cs_cache);
+    if (nEpoch == nEraseEpoch) {
+        AddToReadCache(nBlockHash, txRoot);
+    }
+    return true;
+}
+void CNEVMTxRootsDB::PrefetchTxRoots(const std::vector<uint256>& vecBlockHashes) {
+    std::vector<uint256> vecMissing;
+    uint64_t nEpoch;
+    {
+        std::shared_lock<std::shared_mutex> lock(cs_cache);
+        NEVMTxRoot txRoot;
+        for (const auto& nBlockHash : vecBlockHashes) {
+            if (!FindCached(nBlockHash, txRoot)) {
+                vecMissing.emplace_back(nBlockHash);
+            }
+        }
+        nEpoch = nEraseEpoch;
+    }
+    if (vecMissing.empty()) return;
+    // LevelDB has no multi-get, sorted keys at least walk the table files in order
+    std::sort(vecMissing.begin(), vecMissing.end());
+    vecMissing.erase(std::unique(vecMissing.begin(), vecMissing.end()), vecMissing.end());
+    std::vector<std::pair<uint256, NEVMTxRoot>> vecFound;
+    vecFound.reserve(vecMissing.size());
+    for (const auto& nBlockHash : vecMissing) {
+        NEVMTxRoot txRoot;
+        if (Read(nBlockHash, txRoot)) {
+            vecFound.emplace_back(nBlockHash, txRoot);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(cs_cache);
+    if (nEpoch != nEraseEpoch) return;
+    for (const auto& [nBlockHash, txRoot] : vecFound) {
+        AddToReadCache(nBlockHash, txRoot);
     }
-    return Read(nBlockHash, txRoot);
-} 
+}
 bool CNEVMTxRootsDB::FlushErase(const std::vector<uint256> &vecBlockHashes) {
-    LOCK(cs_cache);
+    std::unique_lock<std::shared_mutex> lock(cs_cache);
     if(vecBlockHashes.empty())
         return true;
+    nEraseEpoch++;
     CDBBatch batch(*this);
     for (const auto& hash: vecBlockHashes) {
         batch.Erase(hash);
-        auto it = mapCache.find(hash);
-        if (it != mapCache.end()) {
-            mapCache.erase(hash);
-        }
+        mapCache.erase(hash);
+        EraseFromReadCache(hash);
     }
     if(vecBlockHashes.size() > 0)
         LogPrint(BCLog::SYS, "Flushing, erasing %d nevm tx roots\n", vecBlockHashes.size());
     return WriteBatch(batch, true);
 }
+void CMintedTxFilter::Reset(uint64_t nCapacityIn) {
+    nCapacity = std::max(nCapacityIn, MIN_CAPACITY);
+    nHashFuncs = HASH_FUNCS;
+    nElements = 0;
+    vData.assign((nCapacity * BITS_PER_ELEMENT + 63) / 64, 0);
+}
+// tx hashes are keccak outputs so two words of the hash give independent probes (double hashing)
+void CMintedTxFilter::Insert(const uint256& hash) {
+    const uint64_t nBits = vData.size() * 64;
+    const uint64_t h1 = hash.GetUint64(0);
+    const uint64_t h2 = hash.GetUint64(1) | 1;
+    for (uint32_t i = 0; i < nHashFuncs; i++) {
+        const uint64_t nBit = (h1 + i * h2) % nBits;
+        vData[nBit >> 6] |= uint64_t{1} << (nBit & 63);
+    }
+    nElements++;
+}
+bool CMintedTxFilter::MaybeContains(const uint256& hash) const {
+    if (IsNull()) return true;
+    const uint64_t nBits = vData.size() * 64;
+    const uint64_t h1 = hash.GetUint64(0);
+    const uint64_t h2 = hash.GetUint64(1) | 1;
+    for (uint32_t i = 0; i < nHashFuncs; i++) {
+        const uint64_t nBit = (h1 + i * h2) % nBits;
+        if (!(vData[nBit >> 6] & (uint64_t{1} << (nBit & 63)))) return false;
+    }
+    return true;
+}
+// stored next to the 32 byte tx hash keys, a key of another length never parses as a tx hash
+static const std::string MINT_FILTER_KEY{"mintfilter"};
+static const std::string MINT_FILTER_BEST_BLOCK_KEY{"mintfilterblock"};
+
+void CNEVMMintedTxDB::LoadFilter(const uint256& hashBestBlock) {
+    LOCK(cs_flush);
+    uint256 hashFilterDB;
+    CMintedTxFilter filterDB;
+    if (Read(MINT_FILTER_BEST_BLOCK_KEY, hashFilterDB) && hashFilterDB == hashBestBlock &&
+        Read(MINT_FILTER_KEY, filterDB) && !filterDB.IsNull()) {
+        {
+            std::unique_lock<std::shared_mutex> lock(cs_filter);
+            filter = std::move(filterDB);
+        }
+        hashFilterBestBlock = hashBestBlock;
+        LogPrint(BCLog::SYS, "Loaded NEVM-minted-tx filter saved at block %s\n", hashBestBlock.ToString());
+        return;
+    }
+    LogPrint(BCLog::SYS, "NEVM-minted-tx filter was not saved at block %s, rebuilding\n", hashBestBlock.ToString());
+    RebuildFilter(CMintedTxFilter::MIN_CAPACITY);
+}
+bool CNEVMMintedTxDB::RebuildFilter(uint64_t nCapacity) {
+    std::vector<uint256> vecKeys;
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    for (pcursor->SeekToFirst(); pcursor->Valid(); pcursor->Next()) {
+        uint256 key;
+        if (pcursor->GetKey(key)) {
+            vecKeys.emplace_back(key);
+        }
+    }
+    for (auto& shard : shards) {
+        LOCK(shard.cs);
+        vecKeys.insert(vecKeys.end(), shard.setCache.begin(), shard.setCache.end());
+    }
+    while (nCapacity < vecKeys.size()) {
+        nCapacity *= 2;
+    }
+    CMintedTxFilter filterNew;
+    filterNew.Reset(nCapacity);
+    for (const auto& key : vecKeys) {
+        filterNew.Insert(key);
+    }
+    {
+        std::unique_lock<std::shared_mutex> lock(cs_filter);
+        filter = std::move(filterNew);
+    }
+    fFilterDirty = true;
+    LogPrint(BCLog::SYS, "Rebuilt NEVM-minted-tx filter with %zu entries, capacity %d\n", vecKeys.size(), nCapacity);
+    return true;
+}
 void CNEVMMintedTxDB::FlushDataToCache(const NEVMMintTxSet &mapNEVMTxRoots) {
-    LOCK(cs_cache);
+    LOCK(cs_flush);
+    bool fFull{false};
+    {
+        std::unique_lock<std::shared_mutex> lock(cs_filter);
+        if (!filter.IsNull()) {
+            for (auto const& key : mapNEVMTxRoots) {
+                filter.Insert(key);
+            }
+            fFull = filter.IsFull();
+            fFilterDirty = true;
+        }
+    }
     for (auto const& key : mapNEVMTxRoots) {
-        mapCache.insert(key);
+        auto& shard = GetShard(key);
+        LOCK(shard.cs);
+        shard.setCache.insert(key);
+    }
+    if (fFull) {
+        RebuildFilter(filter.GetElements() * 2);
     }
 }
-bool CNEVMMintedTxDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
+bool CNEVMMintedTxDB::FlushCacheToDisk(const uint256& hashBestBlock, std::size_t CHUNK_ITEMS, bool fSync)
 {
-    LOCK(cs_cache);
-    if (mapCache.empty()) return true;
+    LOCK(cs_flush);
+    std::vector<uint256> vecKeys;
+    for (auto& shard : shards) {
+        LOCK(shard.cs);
+        vecKeys.insert(vecKeys.end(), shard.setCache.begin(), shard.setCache.end());
+    }
+    if (vecKeys.empty() && !fFilterDirty && hashBestBlock == hashFilterBestBlock) return true;
 
     CDBBatch batch(*this);
     std::size_t items = 0;
-    std::size_t count = 0;
+    bool fFilterSaved{false};
+    {
+        // the filter already covers every cached key so writing it with the first chunk keeps it a superset of the disk keys
+        std::shared_lock<std::shared_mutex> lock(cs_filter);
+        if (filter.IsNull()) {
+            // not loaded yet, a filter saved earlier does not cover the markers written now
+            batch.Erase(MINT_FILTER_BEST_BLOCK_KEY);
+        } else {
+            if (fFilterDirty) {
+                batch.Write(MINT_FILTER_KEY, filter);
+            }
+            batch.Write(MINT_FILTER_BEST_BLOCK_KEY, hashBestBlock);
+            fFilterSaved = true;
+        }
+    }
 
     auto flush = [&]() {
         if (batch.SizeEstimate() == 0) return true;
@@ -724,41 +1093,80 @@ bool CNEVMMintedTxDB::FlushCacheToDisk(std::size_t CHUNK_ITEMS, bool fSync)
         return true;
     };
 
-    for (auto it = mapCache.begin(); it != mapCache.end(); ) {
-        batch.Write(*it, true);       // value is a dummy bool
-        count++;
+    for (const auto& key : vecKeys) {
+        batch.Write(key, true);       // value is a dummy bool
         if (++items == CHUNK_ITEMS) {
             if (!flush()) return false;
         }
-        it = mapCache.erase(it);      // safe to purge now
     }
     if (!flush()) return false;
+    if (fFilterSaved) {
+        hashFilterBestBlock = hashBestBlock;
+        fFilterDirty = false;
+    }
+    // entries are durable, readers find them on disk from here on
+    for (const auto& key : vecKeys) {
+        auto& shard = GetShard(key);
+        LOCK(shard.cs);
+        shard.setCache.erase(key);
+    }
 
     LogPrint(BCLog::SYS,
              "Flushed NEVM-minted-tx cache, %zu items written in %zu-entry chunks\n",
-             count, CHUNK_ITEMS);
+             vecKeys.size(), CHUNK_ITEMS);
     return true;
 }
 
 bool CNEVMMintedTxDB::FlushErase(const NEVMMintTxSet &mapNEVMTxRoots) {
-    LOCK(cs_cache);
+    LOCK(cs_flush);
     if(mapNEVMTxRoots.empty())
         return true;
+    // the filter keeps erased keys, a stale bit only costs a disk read
     CDBBatch batch(*this);
     for (const auto &key : mapNEVMTxRoots) {
         batch.Erase(key);
-        auto it = mapCache.find(key);
-        if(it != mapCache.end()){
-            mapCache.erase(it);
-        }
+        auto& shard = GetShard(key);
+        LOCK(shard.cs);
+        shard.setCache.erase(key);
     }
-    if(mapNEVMTxRoots.size() > 0)
-        LogPrint(BCLog::SYS, "Flushing, erasing %d nevm tx mints\n", mapNEVMTxRoots.size());
+    LogPrint(BCLog::SYS, "Flushing, erasing %d nevm tx mints\n", mapNEVMTxRoots.size());
     return WriteBatch(batch, true);
 }
 bool CNEVMMintedTxDB::ExistsTx(const uint256& nTxHash) {
-    LOCK(cs_cache);
-    return (mapCache.find(nTxHash) != mapCache.end()) || Exists(nTxHash);
+    {
+        auto& shard = GetShard(nTxHash);
+        LOCK(shard.cs);
+        if (shard.setCache.find(nTxHash) != shard.setCache.end()) return true;
+    }
+    {
+        std::shared_lock<std::shared_mutex> lock(cs_filter);
+        if (!filter.MaybeContains(nTxHash)) return false;
+    }
+    return Exists(nTxHash);
+}
+bool CNEVMMintedTxDB::ExistsTxs(const std::vector<uint256>& vecTxHashes, NEVMMintTxSet& setExisting) {
+    std::vector<uint256> vecMaybe;
+    {
+        std::shared_lock<std::shared_mutex> lock(cs_filter);
+        for (const auto& nTxHash : vecTxHashes) {
+            if (filter.MaybeContains(nTxHash)) {
+                vecMaybe.emplace_back(nTxHash);
+            }
+        }
+    }
+    // every cached key is in the filter so only possible hits need the cache or disk
+    for (const auto& nTxHash : vecMaybe) {
+        bool fFound{false};
+        {
+            auto& shard = GetShard(nTxHash);
+            LOCK(shard.cs);
+            fFound = shard.setCache.find(nTxHash) != shard.setCache.end();
+        }
+        if (fFound || Exists(nTxHash)) {
+            setExisting.insert(nTxHash);
+        }
+    }
+    return !setExisting.empty();
 }
 std::string stringFromSyscoinTx(const int &nVersion) {
     switch (nVersion) {
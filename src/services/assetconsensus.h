@@ -9,33 +9,145 @@
 #include <consensus/params.h>
 #include <util/hasher.h>
 #include <sync.h>
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
 class TxValidationState;
 class CTxUndo;
 class CBlock;
+class NEVMTrieNodeCache;
+// Over 50000 NEVM blocks worth of tx roots, mints mostly reference recent ones
+static constexpr size_t DEFAULT_MAX_TXROOTS_CACHE_BYTES{8 << 20};
 class CNEVMTxRootsDB : public CDBWrapper {
+    struct ReadCacheEntry {
+        NEVMTxRoot txRoot;
+        std::list<uint256>::iterator itOrder;
+        // set by readers under the shared lock, gives the entry a second chance on eviction
+        mutable std::atomic<bool> fReferenced{false};
+    };
+    // all guarded by cs_cache, readers take it shared
+    // roots connected but not yet flushed, never evicted
     NEVMTxRootMap mapCache;
-    mutable Mutex cs_cache; // Mutex to protect cache operations (non-recursive for better performance)
+    // bounded cache of roots read from disk, evicted in approximate LRU (clock) order
+    std::unordered_map<uint256, ReadCacheEntry, StaticSaltedHasher> mapReadCache;
+    std::list<uint256> listReadOrder;
+    // bumped on erase so a disk read racing with a disconnect is not cached
+    uint64_t nEraseEpoch{0};
+    const size_t nMaxReadCacheBytes;
+    mutable std::shared_mutex cs_cache;
+    bool FindCached(const uint256& nBlockHash, NEVMTxRoot& txRoot) const;
+    void AddToReadCache(const uint256& nBlockHash, const NEVMTxRoot& txRoot);
+    void EraseFromReadCache(const uint256& nBlockHash);
 public:
-    using CDBWrapper::CDBWrapper;
-    bool FlushErase(const std::vector<uint256> &vecBlockHashes) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool ReadTxRoots(const uint256& nBlockHash, NEVMTxRoot& txRoot) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool FlushCacheToDisk(std::size_t CHUNK_ITEMS = 100000, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    void FlushDataToCache(const NEVMTxRootMap &mapNEVMTxRoots) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    explicit CNEVMTxRootsDB(const DBParams& params, size_t nMaxReadCacheBytesIn = DEFAULT_MAX_TXROOTS_CACHE_BYTES);
+    bool FlushErase(const std::vector<uint256> &vecBlockHashes);
+    bool ReadTxRoots(const uint256& nBlockHash, NEVMTxRoot& txRoot);
+    /** Load the roots of all NEVM blocks a block's mints reference with one pass over the database */
+    void PrefetchTxRoots(const std::vector<uint256>& vecBlockHashes);
+    bool FlushCacheToDisk(std::size_t CHUNK_ITEMS = 100000, bool fSync = true);
+    void FlushDataToCache(const NEVMTxRootMap &mapNEVMTxRoots);
+    size_t ReadCacheUsage() const;
+};
+
+/** Bloom filter over minted NEVM tx hashes, a superset of the keys on disk so that a miss needs no LevelDB read */
+class CMintedTxFilter {
+    std::vector<uint64_t> vData;
+    uint32_t nHashFuncs{0};
+    uint64_t nElements{0};
+    uint64_t nCapacity{0};
+public:
+    // ~0.05% false positives at capacity
+    static constexpr uint32_t BITS_PER_ELEMENT = 16;
+    static constexpr uint32_t HASH_FUNCS = 11;
+    static constexpr uint64_t MIN_CAPACITY = 1 << 16;
+
+    SERIALIZE_METHODS(CMintedTxFilter, obj) {
+        READWRITE(obj.vData, obj.nHashFuncs, obj.nElements, obj.nCapacity);
+    }
+    void Reset(uint64_t nCapacityIn);
+    void Insert(const uint256& hash);
+    bool MaybeContains(const uint256& hash) const;
+    bool IsNull() const { return vData.empty() || nHashFuncs == 0; }
+    bool IsFull() const { return nElements > nCapacity; }
+    uint64_t GetElements() const { return nElements; }
 };
 
 class CNEVMMintedTxDB : public CDBWrapper {
-    NEVMMintTxSet mapCache;
-    mutable Mutex cs_cache; // Mutex to protect cache operations (non-recursive for better performance)
+    // the in-memory set is split by tx hash so concurrent lookups rarely share a lock
+    static constexpr size_t CACHE_SHARDS = 16;
+    struct CacheShard {
+        mutable Mutex cs;
+        NEVMMintTxSet setCache GUARDED_BY(cs);
+    };
+    std::array<CacheShard, CACHE_SHARDS> shards;
+    // shared for lookups and unique when a writer changes the filter
+    mutable std::shared_mutex cs_filter;
+    // null until LoadFilter checked it against the chainstate, every lookup goes to disk until then
+    CMintedTxFilter filter GUARDED_BY(cs_filter);
+    // serializes writers, readers only take a shard lock and the filter lock
+    Mutex cs_flush;
+    // best block saved next to the filter, and whether the filter changed since it was saved
+    uint256 hashFilterBestBlock GUARDED_BY(cs_flush);
+    bool fFilterDirty GUARDED_BY(cs_flush){false};
+    CacheShard& GetShard(const uint256& nTxHash) { return shards[nTxHash.GetUint64(0) % CACHE_SHARDS]; }
+    bool RebuildFilter(uint64_t nCapacity) EXCLUSIVE_LOCKS_REQUIRED(cs_flush);
 public:
-    using CDBWrapper::CDBWrapper;
-    bool FlushErase(const NEVMMintTxSet &setMintTxs) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool FlushCacheToDisk(std::size_t CHUNK_ITEMS = 256, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    void FlushDataToCache(const NEVMMintTxSet &mapNEVMTxRoots) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool ExistsTx(const uint256& nTxHash) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
+    explicit CNEVMMintedTxDB(const DBParams& params) : CDBWrapper(params) {}
+    /**
+     * Use the persisted filter if it was saved at the chainstate's best block, otherwise rebuild it from the
+     * markers on disk. Markers written by a node that doesn't keep the filter always move the best block on.
+     */
+    void LoadFilter(const uint256& hashBestBlock) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush);
+    bool FlushErase(const NEVMMintTxSet &setMintTxs) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush);
+    /** Write the cached markers, and the filter together with the best block the coins view is flushed at next */
+    bool FlushCacheToDisk(const uint256& hashBestBlock, std::size_t CHUNK_ITEMS = 256, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush);
+    void FlushDataToCache(const NEVMMintTxSet &mapNEVMTxRoots) EXCLUSIVE_LOCKS_REQUIRED(!cs_flush);
+    bool ExistsTx(const uint256& nTxHash);
+    /** Look up the mints of a whole block at once, returns whether any already exist and fills setExisting with them */
+    bool ExistsTxs(const std::vector<uint256>& vecTxHashes, NEVMMintTxSet& setExisting);
 };
 
+/**
+ * Closure verifying a mint's tx and receipt Merkle-Patricia proofs and the tx fields they
+ * authenticate, so that ConnectBlock can run it on the check queue next to the script checks.
+ */
+class CMintProofCheck
+{
+private:
+    const CMintSyscoin* mintSyscoin{nullptr};
+    std::shared_ptr<const CMintSyscoin> mintSyscoinOwner;
+    bool fBridgeCanonicalActive{false};
+    uint32_t nHeight{0};
+    NEVMTrieNodeCache* pnodeCache{nullptr};
+    uint256 cacheEntry;
+    bool fCacheStore{false};
+    std::optional<uint8_t> txEnvelopeType;
+public:
+    CMintProofCheck() {}
+    CMintProofCheck(const CMintSyscoin& mintSyscoinIn, const bool fBridgeCanonicalActiveIn, const uint32_t nHeightIn, NEVMTrieNodeCache* pnodeCacheIn);
+    /** Queued check, storing cacheEntryIn in the mint proof cache on success if fCacheStoreIn */
+    CMintProofCheck(std::shared_ptr<const CMintSyscoin> mintSyscoinIn, const bool fBridgeCanonicalActiveIn, const uint32_t nHeightIn, NEVMTrieNodeCache* pnodeCacheIn, const uint256& cacheEntryIn, const bool fCacheStoreIn);
+    /** Verify both proofs against the committed roots, recording the tx envelope type */
+    bool VerifyProofs(std::string& strError);
+    /** Check chain id and destination of the proven tx, needs VerifyProofs() first */
+    bool CheckTxValue(std::string& strError) const;
+    bool operator()() noexcept;
+};
+
+// Mints are rare next to signatures, 1MiB holds over 30000 verified mint proofs
+static constexpr size_t DEFAULT_MAX_MINT_PROOF_CACHE_BYTES{1 << 20};
+/** To be called once in AppInitMain/BasicTestingSetup to initialize the mint proof cache */
+[[nodiscard]] bool InitMintProofCache(size_t max_size_bytes);
+
 extern std::unique_ptr<CNEVMTxRootsDB> pnevmtxrootsdb;
 extern std::unique_ptr<CNEVMMintedTxDB> pnevmtxmintdb;
+/** Mints of a block, parsed once by ConnectBlock and keyed by txid. Their replay lookup already ran for the whole block */
+typedef std::unordered_map<uint256, std::shared_ptr<const CMintSyscoin>, SaltedTxidHasher> NEVMMintParsedMap;
 bool DisconnectMintAsset(const CTransaction &tx, NEVMMintTxSet &setMintTxs);
 bool CheckSyscoinMint(const CTransaction& tx, 
     const uint256& txHash,
@@ -44,7 +156,11 @@ bool CheckSyscoinMint(const CTransaction& tx,
     const bool &fJustCheck, 
     NEVMMintTxSet &setMintTxs, 
     CAssetsMap &mapAssetIn, 
-    CAssetsMap &mapAssetOut);
+    CAssetsMap &mapAssetOut,
+    const bool fCacheStore = false,
+    std::vector<CMintProofCheck>* pvMintChecks = nullptr,
+    NEVMTrieNodeCache* pnodeCache = nullptr,
+    const NEVMMintParsedMap* pmapParsedMints = nullptr);
 bool CheckSyscoinMintInternal(const CMintSyscoin &mintSyscoin,
     TxValidationState &state,
     const bool &fJustCheck,
@@ -53,7 +169,10 @@ bool CheckSyscoinMintInternal(const CMintSyscoin &mintSyscoin,
     NEVMMintTxSet &setMintTxs,
     uint64_t &nAssetFromLog,
     CAmount &outputAmount,
-    std::string &witnessAddress);
+    std::string &witnessAddress,
+    const bool fSkipProofChecks = false,
+    NEVMTrieNodeCache* pnodeCache = nullptr,
+    const bool fReplayChecked = false);
 bool CheckSyscoinInputs(const Consensus::Params& params, 
     const CTransaction& tx, 
     const uint256& txHash, 
@@ -62,7 +181,11 @@ bool CheckSyscoinInputs(const Consensus::Params& params,
     const bool &fJustCheck, 
     NEVMMintTxSet &setMintTxs, 
     CAssetsMap& mapAssetIn, 
-    CAssetsMap& mapAssetOut);
+    CAssetsMap& mapAssetOut,
+    const bool fCacheStore = false,
+    std::vector<CMintProofCheck>* pvMintChecks = nullptr,
+    NEVMTrieNodeCache* pnodeCache = nullptr,
+    const NEVMMintParsedMap* pmapParsedMints = nullptr);
 bool CheckAssetAllocationInputs(const CTransaction &tx, 
     const uint256& txHash, 
     TxValidationState &tstate, 
@@ -17,6 +17,10 @@
 #include <timedata.h>
 #include <key_io.h>
 #include <logging.h>
+#include <streams.h>
+#include <util/fs.h>
+
+#include <set>
 std::unique_ptr<CBlockIndexDB> pblockindexdb;
 std::unique_ptr<CNEVMDataDB> pnevmdatadb;
 std::unique_ptr<CNEVMDataBlobDB> pnevmdatablobdb;
@@ -38,7 +42,7 @@ void CNEVMDataDB::FlushDataToCache(const PoDAMAPMemory &mapPoDA, PoDAFlushSource
     if(mapPoDA.empty()) {
         return;
     }
-    CDBBatch batchblob(*pnevmdatablobdb);  
+    PoDAMAPMemory mapNewBlobs;
     for (auto const& [key, val] : mapPoDA) {
         if(!val.vchNEVMData) {
             continue;
@@ -51,6 +55,8 @@ void CNEVMDataDB::FlushDataToCache(const PoDAMAPMemory &mapPoDA, PoDAFlushSource
                     inserted.first->second.nMedianTime = val.nMedianTime;
                     inserted.first->second.txid = val.txid;
                 }
+                // the blob lives on until its refreshed expiry, keep its segment around as well
+                pnevmdatablobdb->TouchBlob(key, val.nMedianTime);
             }
             continue;
         }
@@ -59,15 +65,14 @@ void CNEVMDataDB::FlushDataToCache(const PoDAMAPMemory &mapPoDA, PoDAFlushSource
             if(source == PoDAFlushSource::Block && inserted.first->second.nSize == val.nSize) {
                 inserted.first->second.nMedianTime = val.nMedianTime;
                 inserted.first->second.txid = val.txid;
+                pnevmdatablobdb->TouchBlob(key, val.nMedianTime);
             }
             continue;
         }
-        if(!pnevmdatablobdb->Exists(key)) {
-            batchblob.Write(key, val.vchNEVMData);
-        }
+        mapNewBlobs.emplace(key, val);
     }
-    if(batchblob.SizeEstimate() > 0) {
-        pnevmdatablobdb->WriteBatch(batchblob);
+    if(!mapNewBlobs.empty() && !pnevmdatablobdb->WriteBlobs(mapNewBlobs)) {
+        LogPrintf("FlushDataToCache: could not write %d nevm blobs\n", mapNewBlobs.size());
     }
 }
 bool CNEVMDataDB::FlushCacheToDisk(const int64_t nMedianTime, bool fSync) {
@@ -86,12 +91,11 @@ bool CNEVMDataDB::FlushCacheToDisk(const int64_t nMedianTime, bool fSync) {
     CDBBatch batch(*this);
     // only prune on testnet flush, mainnet relies only on CL
     if(fTestNet) {
-        CDBBatch batchblob(*pnevmdatablobdb);
-        if (!PruneToBatch(batch, batchblob, nMedianTime)) {
+        NEVMDataVec vecExpiredKeys;
+        if (!PruneToBatch(batch, vecExpiredKeys, nMedianTime) || !pnevmdatablobdb->Prune(vecExpiredKeys, nMedianTime, fSync)) {
             LogPrint(BCLog::SYS, "Error: Could not prune nevm blobs\n");
             return false;
         }
-        pnevmdatablobdb->WriteBatch(batchblob);
     }
     for (auto const& [key, val] : mapCache) {
         batch.Write(key, val);
@@ -146,13 +150,251 @@ bool CNEVMDataDB::FlushMempoolErase(const std::vector<uint8_t>& vchVersionHash,
     mapCache.erase(it);
     return pnevmdatablobdb->FlushErase({vchVersionHash});
 }
+static constexpr uint8_t DB_BLOB_LOCATION{'L'};
+static constexpr uint8_t DB_SEGMENT_BLOB{'M'};
+static constexpr uint8_t DB_SEGMENT_INFO{'S'};
+// segment files are appended to blob by blob, never pre-allocated
+static constexpr size_t NEVM_BLOB_SEGMENT_CHUNK_SIZE = MAX_NEVM_DATA_BLOB;
+
+CNEVMDataBlobDB::CNEVMDataBlobDB(const DBParams& params) :
+    CDBWrapper(params),
+    m_segment_seq(params.path / "segments", "seg", NEVM_BLOB_SEGMENT_CHUNK_SIZE),
+    m_memory_only(params.memory_only)
+{
+    LOCK(cs_segments);
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->Seek(std::make_pair(DB_SEGMENT_INFO, uint32_t{0}));
+    std::pair<uint8_t, uint32_t> key;
+    while (pcursor->Valid() && pcursor->GetKey(key) && key.first == DB_SEGMENT_INFO) {
+        NEVMBlobSegmentInfo info;
+        if (pcursor->GetValue(info)) {
+            m_segments.emplace(key.second, info);
+        }
+        pcursor->Next();
+    }
+    // blobs written as plain values are keyed by the bare serialized version hash
+    std::vector<uint8_t> vchVersionHash;
+    pcursor->Seek(std::vector<uint8_t>(NEVM_DATA_LEGACY_VERSIONHASH_SIZE, 0));
+    m_has_legacy = m_memory_only || (pcursor->Valid() && pcursor->GetKey(vchVersionHash) && IsValidNEVMVersionHash(vchVersionHash));
+    LogPrint(BCLog::SYS, "Loaded %d nevm blob segments%s\n", m_segments.size(), m_has_legacy ? " (with legacy blob values)" : "");
+}
+
+bool CNEVMDataBlobDB::HaveBlobInternal(const std::vector<uint8_t>& vchVersionHash) const {
+    AssertLockHeld(cs_segments);
+    return Exists(std::make_pair(DB_BLOB_LOCATION, vchVersionHash)) || (m_has_legacy && Exists(vchVersionHash));
+}
+
+bool CNEVMDataBlobDB::HaveBlob(const std::vector<uint8_t>& vchVersionHash) const {
+    LOCK(cs_segments);
+    return HaveBlobInternal(vchVersionHash);
+}
+
+uint32_t CNEVMDataBlobDB::GetWriteSegment(const uint32_t nSize, const int64_t nMedianTime) {
+    AssertLockHeld(cs_segments);
+    if (m_segments.empty()) {
+        m_segments.emplace(0, NEVMBlobSegmentInfo{});
+        return 0;
+    }
+    const auto& [nFile, info] = *m_segments.rbegin();
+    if (info.nBlobs == 0 || (info.nSize + nSize <= MAX_NEVM_BLOB_SEGMENT_SIZE && nMedianTime - info.nTimeFirst <= NEVM_BLOB_SEGMENT_TIMESPAN)) {
+        return nFile;
+    }
+    const uint32_t nNextFile = nFile + 1;
+    m_segments.emplace(nNextFile, NEVMBlobSegmentInfo{});
+    return nNextFile;
+}
+
+bool CNEVMDataBlobDB::WriteBlobs(const PoDAMAPMemory &mapBlobs) {
+    LOCK(cs_segments);
+    CDBBatch batch(*this);
+    if (m_memory_only) {
+        for (auto const& [key, val] : mapBlobs) {
+            if (val.vchNEVMData && !Exists(key)) {
+                batch.Write(key, *val.vchNEVMData);
+            }
+        }
+        return WriteBatch(batch, true);
+    }
+    // segment bookkeeping only changes for good once the index batch is written
+    const auto segmentsBefore{m_segments};
+    const auto fail = [&](const std::string& strError) EXCLUSIVE_LOCKS_REQUIRED(cs_segments) {
+        m_segments = segmentsBefore;
+        return error("%s: %s", __func__, strError);
+    };
+    std::set<uint32_t> setTouched;
+    std::set<uint32_t> setBumped;
+    for (auto const& [key, val] : mapBlobs) {
+        if (!val.vchNEVMData) {
+            continue;
+        }
+        if (HaveBlobInternal(key)) {
+            // already stored, but its segment has to outlive the new expiry as well
+            if (const auto nFile{TouchBlobInternal(key, val.nMedianTime)}) {
+                setBumped.insert(*nFile);
+            }
+            continue;
+        }
+        const uint32_t nSize = val.vchNEVMData->size();
+        const uint32_t nFile = GetWriteSegment(nSize, val.nMedianTime);
+        NEVMBlobSegmentInfo& info = m_segments[nFile];
+        AutoFile file{m_segment_seq.Open(FlatFilePos(nFile, info.nSize))};
+        if (file.IsNull()) {
+            return fail(strprintf("failed to open nevm blob segment %d", nFile));
+        }
+        try {
+            file << Span{*val.vchNEVMData};
+        } catch (const std::exception& e) {
+            return fail(strprintf("failed to write nevm blob segment %d: %s", nFile, e.what()));
+        }
+        batch.Write(std::make_pair(DB_BLOB_LOCATION, key), NEVMBlobLocation{nFile, info.nSize, nSize});
+        batch.Write(std::make_pair(DB_SEGMENT_BLOB, std::make_pair(nFile, key)), uint8_t{0});
+        info.nTimeFirst = info.nBlobs == 0 ? val.nMedianTime : std::min(info.nTimeFirst, val.nMedianTime);
+        info.nTimeLast = std::max(info.nTimeLast, val.nMedianTime);
+        info.nSize += nSize;
+        info.nBlobs++;
+        setTouched.insert(nFile);
+    }
+    // blob data has to be on disk before the index points at it
+    for (const uint32_t nFile : setTouched) {
+        const NEVMBlobSegmentInfo& info = m_segments[nFile];
+        if (!m_segment_seq.Flush(FlatFilePos(nFile, info.nSize))) {
+            return fail(strprintf("failed to flush nevm blob segment %d", nFile));
+        }
+        batch.Write(std::make_pair(DB_SEGMENT_INFO, nFile), info);
+    }
+    for (const uint32_t nFile : setBumped) {
+        if (!setTouched.count(nFile)) {
+            batch.Write(std::make_pair(DB_SEGMENT_INFO, nFile), m_segments[nFile]);
+        }
+    }
+    if (!WriteBatch(batch, true)) {
+        return fail("failed to write nevm blob index");
+    }
+    return true;
+}
+
+bool CNEVMDataBlobDB::ReadBlob(const std::vector<uint8_t>& vchVersionHash, std::vector<uint8_t>& vchData) const {
+    NEVMBlobLocation loc;
+    std::FILE* pfile{nullptr};
+    {
+        // only the lookup and the open are serialized with writers and Prune. An open segment stays readable
+        // even if Prune unlinks it meanwhile, so the read itself runs without the lock.
+        LOCK(cs_segments);
+        if (Read(std::make_pair(DB_BLOB_LOCATION, vchVersionHash), loc)) {
+            pfile = m_segment_seq.Open(FlatFilePos(loc.nFile, loc.nPos), true);
+            if (!pfile) {
+                return error("%s: failed to open nevm blob segment %d", __func__, loc.nFile);
+            }
+        } else if (!m_has_legacy) {
+            return false;
+        }
+    }
+    if (!pfile) {
+        return Read(vchVersionHash, vchData);
+    }
+    AutoFile file{pfile};
+    vchData.resize(loc.nSize);
+    try {
+        file >> Span{vchData};
+    } catch (const std::exception& e) {
+        return error("%s: failed to read nevm blob segment %d: %s", __func__, loc.nFile, e.what());
+    }
+    return true;
+}
+
+std::optional<uint32_t> CNEVMDataBlobDB::TouchBlobInternal(const std::vector<uint8_t>& vchVersionHash, const int64_t nMedianTime) {
+    AssertLockHeld(cs_segments);
+    NEVMBlobLocation loc;
+    if (!Read(std::make_pair(DB_BLOB_LOCATION, vchVersionHash), loc)) {
+        return std::nullopt;
+    }
+    auto it = m_segments.find(loc.nFile);
+    if (it == m_segments.end() || it->second.nTimeLast >= nMedianTime) {
+        return std::nullopt;
+    }
+    it->second.nTimeLast = nMedianTime;
+    return loc.nFile;
+}
+
+bool CNEVMDataBlobDB::TouchBlob(const std::vector<uint8_t>& vchVersionHash, const int64_t nMedianTime) {
+    LOCK(cs_segments);
+    const auto nFile{TouchBlobInternal(vchVersionHash, nMedianTime)};
+    if (!nFile) {
+        return true;
+    }
+    return Write(std::make_pair(DB_SEGMENT_INFO, *nFile), m_segments[*nFile]);
+}
+
 bool CNEVMDataBlobDB::FlushErase(const NEVMDataVec &vecDataKeys) {
-    CDBBatch batch(*this);    
+    LOCK(cs_segments);
+    CDBBatch batch(*this);
     for (const auto &key : vecDataKeys) {
-        batch.Erase(key);
+        // the bytes stay in their segment until the whole segment expires
+        NEVMBlobLocation loc;
+        if (Read(std::make_pair(DB_BLOB_LOCATION, key), loc)) {
+            batch.Erase(std::make_pair(DB_BLOB_LOCATION, key));
+            batch.Erase(std::make_pair(DB_SEGMENT_BLOB, std::make_pair(loc.nFile, key)));
+        }
+        if (m_has_legacy) {
+            batch.Erase(key);
+        }
     }
     return WriteBatch(batch, true);
 }
+
+void CNEVMDataBlobDB::EraseSegmentIndex(CDBBatch& batch, const uint32_t nFile) {
+    AssertLockHeld(cs_segments);
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->Seek(std::make_pair(DB_SEGMENT_BLOB, std::make_pair(nFile, std::vector<uint8_t>{})));
+    std::pair<uint8_t, std::pair<uint32_t, std::vector<uint8_t>>> key;
+    while (pcursor->Valid() && pcursor->GetKey(key) && key.first == DB_SEGMENT_BLOB && key.second.first == nFile) {
+        const std::vector<uint8_t>& vchVersionHash = key.second.second;
+        NEVMBlobLocation loc;
+        // a blob erased from this segment may have been stored again in a newer one
+        if (Read(std::make_pair(DB_BLOB_LOCATION, vchVersionHash), loc) && loc.nFile == nFile) {
+            batch.Erase(std::make_pair(DB_BLOB_LOCATION, vchVersionHash));
+        }
+        batch.Erase(key);
+        pcursor->Next();
+    }
+    batch.Erase(std::make_pair(DB_SEGMENT_INFO, nFile));
+}
+
+bool CNEVMDataBlobDB::Prune(const NEVMDataVec &vecExpiredKeys, const int64_t nMedianTime, bool fSync) {
+    LOCK(cs_segments);
+    CDBBatch batch(*this);
+    if (m_has_legacy) {
+        for (const auto &key : vecExpiredKeys) {
+            batch.Erase(key);
+        }
+    }
+    std::vector<uint32_t> vecExpiredSegments;
+    for (const auto& [nFile, info] : m_segments) {
+        if (info.nBlobs > 0 && nMedianTime > (info.nTimeLast + NEVM_DATA_EXPIRE_TIME)) {
+            vecExpiredSegments.push_back(nFile);
+            EraseSegmentIndex(batch, nFile);
+        }
+    }
+    if (!WriteBatch(batch, fSync)) {
+        return false;
+    }
+    for (const uint32_t nFile : vecExpiredSegments) {
+        const fs::path path = m_segment_seq.FileName(FlatFilePos(nFile, 0));
+        std::error_code ec;
+        fs::remove(path, ec);
+        if (ec) {
+            LogPrintf("%s: failed to remove %s: %s\n", __func__, fs::PathToString(path), ec.message());
+        }
+        LogPrint(BCLog::SYS, "Pruned nevm blob segment %d (%d blobs, %d bytes)\n", nFile, m_segments[nFile].nBlobs, m_segments[nFile].nSize);
+        m_segments.erase(nFile);
+    }
+    return true;
+}
+
+size_t CNEVMDataBlobDB::GetSegmentCount() const {
+    LOCK(cs_segments);
+    return m_segments.size();
+}
 bool CNEVMDataDB::BlobExists(const std::vector<uint8_t>& vchVersionHash) {
     LOCK(cs_cache);
     return (mapCache.find(vchVersionHash) != mapCache.end()) || Exists(vchVersionHash);
@@ -172,7 +414,7 @@ const PoDAMAPMemory& CNEVMDataDB::GetCache() const {
 }
 bool CNEVMDataDB::PruneToBatch(
     CDBBatch& batch,
-    CDBBatch& batchblob,
+    NEVMDataVec& vecExpiredKeys,
     const int64_t nMedianTime)
 {
     AssertLockHeld(cs_cache);
@@ -182,7 +424,7 @@ bool CNEVMDataDB::PruneToBatch(
         const int64_t entryTime = it->second.nMedianTime;
         bool isExpired = nMedianTime > (entryTime + NEVM_DATA_EXPIRE_TIME);
         if (isExpired) {
-            batchblob.Erase(it->first);
+            vecExpiredKeys.emplace_back(it->first);
             it = mapCache.erase(it);
             ++nCount;
         } else {
@@ -204,7 +446,7 @@ bool CNEVMDataDB::PruneToBatch(
                 bool isExpired = nMedianTime > (meta.nMedianTime + NEVM_DATA_EXPIRE_TIME);
                 if (isExpired) {
                     batch.Erase(vchVersionHash);
-                    batchblob.Erase(vchVersionHash);
+                    vecExpiredKeys.emplace_back(vchVersionHash);
                     ++nCount;
                 }
             }
@@ -223,9 +465,9 @@ bool CNEVMDataDB::PruneStandalone(const int64_t nMedianTime, bool fSync)
 {
     LOCK(cs_cache);
     CDBBatch batch(*this);
-    CDBBatch batchblob(*pnevmdatablobdb);
-    if (!PruneToBatch(batch, batchblob, nMedianTime)) {
+    NEVMDataVec vecExpiredKeys;
+    if (!PruneToBatch(batch, vecExpiredKeys, nMedianTime)) {
         return false;
     }
-    return WriteBatch(batch, fSync) && pnevmdatablobdb->WriteBatch(batchblob, fSync);
+    return WriteBatch(batch, fSync) && pnevmdatablobdb->Prune(vecExpiredKeys, nMedianTime, fSync);
 }
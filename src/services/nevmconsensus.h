@@ -6,9 +6,12 @@
 #define SYSCOIN_SERVICES_NEVMCONSENSUS_H
 #include <primitives/transaction.h>
 #include <dbwrapper.h>
+#include <flatfile.h>
 #include <consensus/params.h>
 #include <util/hasher.h>
 #include <sync.h>
+#include <map>
+#include <optional>
 class TxValidationState;
 class CCoinsViewCache;
 class CTxUndo;
@@ -38,16 +41,64 @@ public:
     bool FlushCacheToDisk(const int64_t nMedianTime, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     void FlushDataToCache(const PoDAMAPMemory &mapPoDA, PoDAFlushSource source) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool PruneStandalone(const int64_t nMedianTime, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
-    bool PruneToBatch(CDBBatch& batch,CDBBatch& batchblob,  const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
+    bool PruneToBatch(CDBBatch& batch, NEVMDataVec& vecExpiredKeys, const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
     bool GetBlobMetaData(const std::vector<uint8_t>& vchVersionhash, MapPoDAPayloadMeta& meta) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     bool BlobExists(const std::vector<uint8_t>& vchVersionhash) EXCLUSIVE_LOCKS_REQUIRED(!cs_cache);
     const PoDAMAPMemory& GetCache() const EXCLUSIVE_LOCKS_REQUIRED(cs_cache);
 };
+/** Position of a PoDA blob inside a blob segment file */
+struct NEVMBlobLocation {
+    uint32_t nFile{0};
+    uint32_t nPos{0};
+    uint32_t nSize{0};
+    SERIALIZE_METHODS(NEVMBlobLocation, obj) {
+        READWRITE(VARINT(obj.nFile), VARINT(obj.nPos), VARINT(obj.nSize));
+    }
+};
+/** Bookkeeping for one blob segment file, the segment is unlinked once its newest blob has expired */
+struct NEVMBlobSegmentInfo {
+    uint32_t nSize{0};
+    uint32_t nBlobs{0};
+    int64_t nTimeFirst{0};
+    int64_t nTimeLast{0};
+    SERIALIZE_METHODS(NEVMBlobSegmentInfo, obj) {
+        READWRITE(obj.nSize, obj.nBlobs, obj.nTimeFirst, obj.nTimeLast);
+    }
+};
+/** Segments are closed once they reach this size... */
+static constexpr uint32_t MAX_NEVM_BLOB_SEGMENT_SIZE = 128 * 1024 * 1024;
+static_assert(MAX_NEVM_BLOB_SEGMENT_SIZE >= MAX_NEVM_DATA_BLOB, "a blob must fit in a segment");
+/** ...or once they span this much median time, so a quiet segment can still expire */
+static constexpr int64_t NEVM_BLOB_SEGMENT_TIMESPAN = NEVM_DATA_EXPIRE_TIME / 6;
+/**
+ * Content addressed PoDA blob store. Blobs are appended to flat segment files (segNNNNN.dat under
+ * nevmblobdata/segments) and LevelDB only keeps a compact version hash -> location index, so blob
+ * writes don't go through compaction and expiry unlinks whole segments instead of erasing blobs one by one.
+ * Blobs stored as LevelDB values by older versions (and every blob in memory only mode) are still served.
+ */
 class CNEVMDataBlobDB : public CDBWrapper {
-    public:
-        using CDBWrapper::CDBWrapper;
-        bool FlushErase(const NEVMDataVec &vecDataKeys);
-    };
+private:
+    mutable Mutex cs_segments;
+    //! only hands out file handles, so const readers may open segments too
+    mutable FlatFileSeq m_segment_seq;
+    const bool m_memory_only;
+    bool m_has_legacy GUARDED_BY(cs_segments){false};
+    std::map<uint32_t, NEVMBlobSegmentInfo> m_segments GUARDED_BY(cs_segments);
+    bool HaveBlobInternal(const std::vector<uint8_t>& vchVersionHash) const EXCLUSIVE_LOCKS_REQUIRED(cs_segments);
+    uint32_t GetWriteSegment(const uint32_t nSize, const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(cs_segments);
+    /** Bump the expiry of the segment holding a blob in memory, returns the segment if its info changed */
+    std::optional<uint32_t> TouchBlobInternal(const std::vector<uint8_t>& vchVersionHash, const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(cs_segments);
+    void EraseSegmentIndex(CDBBatch& batch, const uint32_t nFile) EXCLUSIVE_LOCKS_REQUIRED(cs_segments);
+public:
+    explicit CNEVMDataBlobDB(const DBParams& params);
+    bool WriteBlobs(const PoDAMAPMemory &mapBlobs) EXCLUSIVE_LOCKS_REQUIRED(!cs_segments);
+    bool ReadBlob(const std::vector<uint8_t>& vchVersionHash, std::vector<uint8_t>& vchData) const EXCLUSIVE_LOCKS_REQUIRED(!cs_segments);
+    bool HaveBlob(const std::vector<uint8_t>& vchVersionHash) const EXCLUSIVE_LOCKS_REQUIRED(!cs_segments);
+    bool TouchBlob(const std::vector<uint8_t>& vchVersionHash, const int64_t nMedianTime) EXCLUSIVE_LOCKS_REQUIRED(!cs_segments);
+    bool FlushErase(const NEVMDataVec &vecDataKeys) EXCLUSIVE_LOCKS_REQUIRED(!cs_segments);
+    bool Prune(const NEVMDataVec &vecExpiredKeys, const int64_t nMedianTime, bool fSync = true) EXCLUSIVE_LOCKS_REQUIRED(!cs_segments);
+    size_t GetSegmentCount() const EXCLUSIVE_LOCKS_REQUIRED(!cs_segments);
+};
 extern std::unique_ptr<CNEVMDataDB> pnevmdatadb;
 extern std::unique_ptr<CNEVMDataBlobDB> pnevmdatablobdb;
 bool DisconnectSyscoinTransaction(const CTransaction& tx, NEVMMintTxSet &setMintTxs);
@@ -190,7 +190,7 @@ static RPCHelpMan getnevmblobdata()
     }
     if(bGetData) {
         std::vector<uint8_t> vchData;
-        if (!pnevmdatablobdb->Read(vchVH, vchData)) {
+        if (!pnevmdatablobdb->ReadBlob(vchVH, vchData)) {
             throw JSONRPCError(RPC_INVALID_PARAMS, strprintf("Could not find data for versionhash %s", HexStr(vchVH)));
         }       
         oNEVM.pushKVEnd("data", HexStr(vchData));
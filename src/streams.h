@@ -58,7 +58,7 @@ class OverrideStream
 public:
     OverrideStream(Stream* stream_, int nVersion_) : stream{stream_}, nVersion{nVersion_} {}
     // SYSCOIN
-    OverrideStream(Stream* stream_, int nType_, int nVersion_) : stream(stream_), nType(nType_), nVersion(nVersion_) {}
+    OverrideStream(Stream* stream_, int nType_, int nVersion_) : stream(stream_), nVersion(nVersion_), nType(nType_) {}
     template<typename T>
     OverrideStream<Stream>& operator<<(const T& obj)
     {
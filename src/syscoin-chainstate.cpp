@@ -39,6 +39,7 @@
 #include <net.h>
 #include <net_processing.h>
 #include <banman.h>
+#include <services/assetconsensus.h>
 #include <memory>
 #include <string>
 
@@ -71,6 +72,9 @@ int main(int argc, char* argv[])
     kernel::ValidationCacheSizes validation_cache_sizes{};
     Assert(InitSignatureCache(validation_cache_sizes.signature_cache_bytes));
     Assert(InitScriptExecutionCache(validation_cache_sizes.script_execution_cache_bytes));
+    // SYSCOIN
+    Assert(InitMintProofCache(DEFAULT_MAX_MINT_PROOF_CACHE_BYTES));
+    Assert(InitAuxPowCache(DEFAULT_MAX_AUXPOW_CACHE_BYTES));
 
 
     // SETUP: Scheduling and Background Signals
@@ -4,6 +4,7 @@
 
 #include <arith_uint256.h>
 #include <auxpow.h>
+#include <auxpowtag.h>
 #include <chainparams.h>
 #include <coins.h>
 #include <consensus/merkle.h>
@@ -513,6 +514,118 @@ BOOST_FIXTURE_TEST_CASE (auxpow_pow, BasicTestingSetup)
   BOOST_CHECK (!HasValidProofOfWork({block}, params));
 }
 
+BOOST_FIXTURE_TEST_CASE (syscoin_tag_scanner, BasicTestingSetup)
+{
+  const uint256 hash = uint256S ("0x8a3b00cd7f7e9e7a18cc8d5a6a1e2b2ad1d7a4c1b99f2a66d8b6e0d8a01e3c55");
+  const uint32_t height = 1234560;
+
+  /* The miner's encoding is marker, hash and LE height.  */
+  const std::vector<unsigned char> vchTag = EncodeSyscoinAuxpowTag (hash, height);
+  BOOST_CHECK_EQUAL (vchTag.size (), SYSCOIN_TAG_SIZE);
+  BOOST_CHECK (std::equal (std::begin (pchSyscoinHeader), std::end (pchSyscoinHeader), vchTag.begin ()));
+  BOOST_CHECK_EQUAL (vchTag.back (), height >> 24);
+
+  CMutableTransaction mtx;
+  mtx.vout.resize (5);
+  /* Spendable outputs are ignored even if they contain the marker.  */
+  mtx.vout[0].scriptPubKey = CScript () << OP_DUP << vchTag;
+  /* False starts on the marker's first byte, with and without a marker.  */
+  mtx.vout[1].scriptPubKey = CScript () << OP_RETURN << ParseHex ("73737973");
+  mtx.vout[2].scriptPubKey = CScript () << OP_RETURN << std::vector<unsigned char> (80, 's');
+  mtx.vout[3].scriptPubKey = CScript () << OP_RETURN << vchTag;
+  mtx.vout[4].scriptPubKey = CScript () << OP_RETURN << ParseHex ("7379");
+
+  const std::vector<SyscoinAuxpowTag> tags = ScanSyscoinAuxpowTags (CTransaction (mtx));
+  BOOST_REQUIRE_EQUAL (tags.size (), 2U);
+  BOOST_CHECK_EQUAL (tags[0].nOutput, 1U);
+  BOOST_CHECK_EQUAL (tags[0].nMarkerPos, 3U);
+  BOOST_CHECK (!tags[0].fComplete);
+  BOOST_CHECK_EQUAL (tags[1].nOutput, 3U);
+  BOOST_CHECK_EQUAL (tags[1].nMarkerPos, 2U);
+  BOOST_CHECK (tags[1].fComplete);
+  BOOST_CHECK (tags[1].hash == hash);
+  BOOST_CHECK_EQUAL (tags[1].nHeight, height);
+
+  const CScript& tagged = mtx.vout[3].scriptPubKey;
+  BOOST_CHECK (SyscoinAuxpowTagMatches (tagged, tags[1], hash, height));
+  BOOST_CHECK (!SyscoinAuxpowTagMatches (tagged, tags[1], hash, height + 1));
+  BOOST_CHECK (!SyscoinAuxpowTagMatches (mtx.vout[1].scriptPubKey, tags[0], hash, height));
+
+  /* The payload may sit anywhere behind the first marker.  */
+  std::vector<unsigned char> vchLoose (pchSyscoinHeader, pchSyscoinHeader + sizeof (pchSyscoinHeader));
+  vchLoose.insert (vchLoose.end (), {0x00, 's', 'y', 's', 0x01});
+  vchLoose.insert (vchLoose.end (), vchTag.begin () + sizeof (pchSyscoinHeader), vchTag.end ());
+  mtx.vout.assign (1, CTxOut ());
+  mtx.vout[0].scriptPubKey = CScript () << OP_RETURN << vchLoose;
+  const std::vector<SyscoinAuxpowTag> looseTags = ScanSyscoinAuxpowTags (CTransaction (mtx));
+  BOOST_REQUIRE_EQUAL (looseTags.size (), 1U);
+  BOOST_CHECK (looseTags[0].fComplete);
+  BOOST_CHECK (looseTags[0].hash != hash);
+  BOOST_CHECK (SyscoinAuxpowTagMatches (mtx.vout[0].scriptPubKey, looseTags[0], hash, height));
+}
+
+BOOST_FIXTURE_TEST_CASE (auxpow_cache_and_batch_check, ChainTestingSetup)
+{
+  /* Use regtest parameters to allow mining with easy difficulty.  */
+  SelectParams (ChainType::REGTEST);
+  const Consensus::Params& params = Params ().GetConsensus ();
+
+  const arith_uint256 target = (~arith_uint256 (0) >> 1);
+  const int32_t ourChainId = params.nAuxpowChainId;
+  const unsigned height = 3;
+  const int nonce = 7;
+  const int index = CAuxPow::getExpectedIndex (nonce, ourChainId, height);
+
+  const auto buildAuxpowHeader = [&] (uint32_t nTime, bool parentOk) {
+    CBlockHeader block;
+    block.nBits = target.GetCompact ();
+    block.nTime = nTime;
+    block.SetBaseVersion (2, ourChainId);
+    block.SetAuxpowVersion (true);
+    CAuxpowBuilder builder(5, 42);
+    const valtype auxRoot = builder.buildAuxpowChain (block.GetHash (), height, index);
+    builder.setCoinbase (CScript () << CAuxpowBuilder::buildCoinbaseData (true, auxRoot, height, nonce));
+    mineBlock (builder.parentBlock, parentOk, block.nBits);
+    block.SetAuxpow (builder.getUnique ());
+    return block;
+  };
+
+  /* A cached header must not vouch for a different auxpow on the same
+     block hash.  */
+  const CBlockHeader valid = buildAuxpowHeader (1, true);
+  BOOST_CHECK (HasValidProofOfWork({valid}, params));
+  BOOST_CHECK (HasValidProofOfWork({valid}, params));
+  const CBlockHeader badParent = buildAuxpowHeader (1, false);
+  BOOST_CHECK (badParent.GetHash () == valid.GetHash ());
+  BOOST_CHECK (!HasValidProofOfWork({badParent}, params));
+
+  /* Batches mixing plain and merge-mined headers are checked on the
+     worker threads.  */
+  std::vector<CBlockHeader> headers;
+  for (uint32_t i = 0; i < 40; ++i)
+    {
+      if (i % 4 == 0)
+        {
+          CBlockHeader plain;
+          plain.nBits = target.GetCompact ();
+          plain.nTime = 1000 + i;
+          plain.SetBaseVersion (2, ourChainId);
+          mineBlock (plain, true);
+          headers.push_back (plain);
+        }
+      else
+        headers.push_back (buildAuxpowHeader (1000 + i, true));
+    }
+  BOOST_CHECK (HasValidProofOfWork(headers, params));
+
+  headers[17] = buildAuxpowHeader (2000, false);
+  BOOST_CHECK (!HasValidProofOfWork(headers, params));
+  headers[17] = buildAuxpowHeader (2000, true);
+  BOOST_CHECK (HasValidProofOfWork(headers, params));
+  mineBlock (headers[20], false);
+  BOOST_CHECK (!HasValidProofOfWork(headers, params));
+}
+
 /* ************************************************************************** */
 
 /**
@@ -4,6 +4,7 @@
 
 #include <bls/bls.h>
 #include <bls/bls_batchverifier.h>
+#include <bls/bls_worker.h>
 #include <clientversion.h>
 #include <random.h>
 #include <streams.h>
@@ -365,6 +366,14 @@ void FuncBatchVerifier(const bool legacy_scheme)
     // last message invalid from one source
     AddMessage(msgs, 1, 7, 1, false);
     Verify(msgs);
+
+    msgs.clear();
+    // many sources and sessions, the bad ones have to be found by bisection
+    for (uint32_t i = 0; i < 37; ++i) {
+        AddMessage(msgs, i, 2 * i, i % 5, true);
+        AddMessage(msgs, i, 2 * i + 1, 5 + i % 3, i != 3 && i != 20 && i != 36);
+    }
+    Verify(msgs);
 }
 
 void FuncThresholdSignature(const bool legacy_scheme)
@@ -471,6 +480,38 @@ BOOST_AUTO_TEST_CASE(batch_verifier_tests)
     FuncBatchVerifier(false);
 }
 
+BOOST_AUTO_TEST_CASE(bls_worker_pool_lane_priority)
+{
+    CBLSWorkerPool pool;
+    std::vector<BLSWorkerLane> order;
+
+    // queue work on all lanes before any worker runs, the single worker must then drain them by priority
+    std::vector<std::future<void>> futures;
+    for (const auto lane : {BLSWorkerLane::DKG, BLSWorkerLane::AGGREGATE, BLSWorkerLane::SIGN, BLSWorkerLane::DKG, BLSWorkerLane::SIGN}) {
+        futures.emplace_back(pool.Push(lane, [&order, lane](int) { order.emplace_back(lane); }));
+    }
+    BOOST_CHECK_EQUAL(pool.GetStats()[static_cast<size_t>(BLSWorkerLane::DKG)].nQueued, 2U);
+
+    pool.Start(1);
+    for (auto& f : futures) {
+        f.get();
+    }
+
+    const std::vector<BLSWorkerLane> expected{BLSWorkerLane::SIGN, BLSWorkerLane::SIGN, BLSWorkerLane::AGGREGATE, BLSWorkerLane::DKG, BLSWorkerLane::DKG};
+    BOOST_CHECK(order == expected);
+
+    const auto stats = pool.GetStats();
+    BOOST_CHECK_EQUAL(stats[static_cast<size_t>(BLSWorkerLane::SIGN)].nJobs, 2U);
+    BOOST_CHECK_EQUAL(stats[static_cast<size_t>(BLSWorkerLane::AGGREGATE)].nJobs, 1U);
+    BOOST_CHECK_EQUAL(stats[static_cast<size_t>(BLSWorkerLane::DKG)].nJobs, 2U);
+    for (const auto& laneStats : stats) {
+        BOOST_CHECK_EQUAL(laneStats.nQueued, 0U);
+        BOOST_CHECK(laneStats.nMaxWaitUs * (int64_t)laneStats.nJobs >= laneStats.nTotalWaitUs);
+    }
+    pool.Stop();
+    BOOST_CHECK_EQUAL(pool.Size(), 0U);
+}
+
 BOOST_AUTO_TEST_CASE(bls_threshold_signature_tests)
 {
     FuncThresholdSignature(true);
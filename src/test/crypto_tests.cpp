@@ -1076,6 +1076,22 @@ BOOST_AUTO_TEST_CASE(sha256d64)
     }
 }
 
+BOOST_AUTO_TEST_CASE(sha256_64)
+{
+    for (int i = 0; i <= 32; ++i) {
+        unsigned char in[64 * 32];
+        unsigned char out1[32 * 32], out2[32 * 32];
+        for (int j = 0; j < 64 * i; ++j) {
+            in[j] = InsecureRandBits(8);
+        }
+        for (int j = 0; j < i; ++j) {
+            CSHA256().Write(in + 64 * j, 64).Finalize(out1 + 32 * j);
+        }
+        SHA256_64(out2, in, i);
+        BOOST_CHECK(memcmp(out1, out2, 32 * i) == 0);
+    }
+}
+
 static void TestSHA3_256(const std::string& input, const std::string& output)
 {
     const auto in_bytes = ParseHex(input);
@@ -1118,6 +1134,35 @@ BOOST_AUTO_TEST_CASE(keccak_tests)
     BOOST_CHECK_EQUAL(out.ToString(), "5f4a7f2eca7d57740ef9f1a077b4fc67328092ec62620447fe27ad8ed5f7e34f");
 }
 
+// SYSCOIN
+BOOST_AUTO_TEST_CASE(keccak256_many_tests)
+{
+    unsigned char out[SHA3_256::OUTPUT_SIZE];
+    Keccak256({}, out);
+    BOOST_CHECK_EQUAL(HexStr(out), "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+    const std::string abc{"abc"};
+    Keccak256(MakeUCharSpan(abc), out);
+    BOOST_CHECK_EQUAL(HexStr(out), "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
+
+    BOOST_TEST_MESSAGE("Using the '" << KeccakAutoDetect() << "' Keccak implementation");
+    // lengths around the 136 byte rate, lanes finishing at different blocks and a ragged tail
+    const std::vector<size_t> lengths{0, 1, 135, 136, 137, 271, 272, 1000, 136 * 7, 4096, 3, 200, 5000};
+    std::vector<std::vector<unsigned char>> data;
+    std::vector<Span<const unsigned char>> inputs;
+    for (const size_t len : lengths) {
+        data.push_back(g_insecure_rand_ctx.randbytes(len));
+    }
+    for (const auto& d : data) {
+        inputs.emplace_back(d);
+    }
+    std::vector<unsigned char> digests(inputs.size() * SHA3_256::OUTPUT_SIZE);
+    Keccak256Many(inputs, digests);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        Keccak256(inputs[i], out);
+        BOOST_CHECK(std::equal(std::begin(out), std::end(out), digests.begin() + i * SHA3_256::OUTPUT_SIZE));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(sha3_256_tests)
 {
     // Test vectors from https://csrc.nist.gov/CSRC/media/Projects/Cryptographic-Algorithm-Validation-Program/documents/sha3/sha-3bytetestvectors.zip
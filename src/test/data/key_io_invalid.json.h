@@ -0,0 +1,216 @@
+#include <string>
+namespace json_tests{
+static const std::string key_io_invalid = R"json(
+﻿[
+    [
+        ""
+    ],
+    [
+        "x"
+    ],
+    [
+        "1GAdfviErV2Ew95FPtZyikz2qGP3gyCB6Hyu94sedAkPpA523m3fQwps9YKUZkKgQckGPKhRsFR"
+    ],
+    [
+        "37G2kMDLpmWVhimxRdzwNfE8JFvWXnJYnVcXeeGrek2qumdJuK7XArcVVpRtLLjRra3t64BEPF2"
+    ],
+    [
+        "giymtio7u7oqWtmC9YnvAEKkLF3JQpAdkEFkVJKYrVDfaLbhaDpX1ihfF2vZmya1i61fwLPC3YQ"
+    ],
+    [
+        "8iVk9nLM3nYwRuwypjy9NK5rsuZH7BbrQRZ1pgcQmvMnjAgRXD"
+    ],
+    [
+        "cPTVQ1hbo4qdoysf6Jx5GthqucNmdfqt6J2pZRFeXv8Ep7Kmjqud"
+    ],
+    [
+        "cQbR2Ny85XFBzUMx3Ed6HsTLw2pVruSgPvt5AofnBUnhiv86gYeW"
+    ],
+    [
+        "2UB3iG3VJbX2TRrMwm6ssWskgvU9VjFBYSqCzwqkrihCwo7mg4mtS4WuGZgxTKuxf5A3EcotYEymz"
+    ],
+    [
+        "cQe12pqwPR6ExtZKfrKf1q4b3CTh1Qi7MwuvMvzs79nWXDvESfBJ"
+    ],
+    [
+        "tc1qeul5g2xfkvdkrhcfmdursv73ad64jnkjl9c40f"
+    ],
+    [
+        "bt1pq65rzej5glw3ra79gav6fqnx4haa0z257qr3mc8cggkefahmgvyseufhc0"
+    ],
+    [
+        "tb13hty4qmumlwpp6chxjvcyzza4duqgtmxw3xhm3u9ahj4nyhtwz8eq7ynrj4"
+    ],
+    [
+        "bcrt1r2qxpwuge"
+    ],
+    [
+        "bc10uexgzna2dpfk0vjt35srz6a27ps6m0l89jweznt83n2sqn2fx4hvn9ym5af8wut34sfrqhk3"
+    ],
+    [
+        "tb1qum6uh0pt4q253qaf520929737v63w5gf"
+    ],
+    [
+        "bcrt1q888ryfgxpvl0k7vum8zpyar2u2sexvdhkf38ue37yknmqq0ycrwpl3w48y"
+    ],
+    [
+        "bc1qdsuzmn04k2z8vryw8l4dj8m5ygqgnne5n"
+    ],
+    [
+        "tb1qlj8es50nc8j8r8xshrjgzmw5azx89efghmw8ju6zcqla0g6xcnrstsjz7k"
+    ],
+    [
+        "bcrt1qzwmyj0z924g7fzs5yvnrkc43y76RVyr2lh5t4r"
+    ],
+    [
+        "bc1qpu6d26mrulzetu4jqhd7rsunv9aqru26f5c4j8"
+    ],
+    [
+        "tb1qun6d26ufh77ghny6u5u8cwz9da7qwc6k4wkuceae9tth06eqlw0syupl4w"
+    ],
+    [
+        "bcrt1qj7g2jps453kj9htk9cxyyc2nxe69x4kzzmth7v"
+    ],
+    [
+        "bc1p702xksx4z3uqf0u2phllxkfe5cgu0adxptqs0uelx0tqt8e885sqryes2l"
+    ],
+    [
+        "tb1z7gmh0v6pc30z4xum76lmw8w86yswrlmw"
+    ],
+    [
+        "bcrt1sjsrw6nun4h502cr97xmnyyuhkr22q0s6efrgtu"
+    ],
+    [
+        "2UVPFpGYnLHJezFzjUo42our6PMEoozzRdM"
+    ],
+    [
+        "2MygHQjE1U33q3LSC53p69YqFjP8PihumJAF"
+    ],
+    [
+        "KzNbAQ4mexfAxa6RKBzHQqfoTycaeWpv2p"
+    ],
+    [
+        "2jDPrDfAKihCGPbPD9ztY8TswAia4V8Bc6vx"
+    ],
+    [
+        "4VQUNG1hG64QFtaNyQZQWDdwpxB275Pwb3tvyPt2HDxB8Mi2MgH8Tz3AC83YYiz9LydsLNXEZJLHY"
+    ],
+    [
+        "39TKsUQ5QpEL1wowc6GMUqak94ijirPuP69ooV3xsFmiKQX2dau"
+    ],
+    [
+        "2UEJjT3dSdwc8dAo7oedPzznXceXCEsBbDfAvSymqpqDrkZMv7JBEUpLyhkghioYAWC9W4sKysry"
+    ],
+    [
+        "7VmMEkphxCFSV1y659Th4dkk6x6bJS5eQvbt8rzUYKQyd6ACgwQ4vXHtXKFUwP2kW3XULipnHJdZ7"
+    ],
+    [
+        "tc1qdlapns4zkn03juf2k9xwwpct209suj6mgcd9gh"
+    ],
+    [
+        "bt1psa5eptk29c4jc9yumeseat3a0l5e2fpmw635za2p4gpwdnthueysxga9je"
+    ],
+    [
+        "tb13w8c43lykfj3lvm9sgp6dsnfjla3d57cm83seykunf0ltxjc9lt2q4efm4d"
+    ],
+    [
+        "bcrt1rjqr2tdkm"
+    ],
+    [
+        "bc10lyxwnxa70l270e6fcmxr4x7dtgu2yvy7gzkurwxy4zhdvgaqrrn6pfg2flyhqzy5t5se8yu3"
+    ],
+    [
+        "TB1QFDFM763VXVSUNZHQLPWC0Q8FG5LJX6ZN"
+    ],
+    [
+        "bcrt1q60chha7wfwlau4kdr4mlvyeyc8mnnh9dhxk05e0hmrxcuhghefj36uwyha"
+    ],
+    [
+        "bc1gmk9yu"
+    ],
+    [
+        "tb1ly0q7p"
+    ],
+    [
+        "bcrt1qdwttaw38uf42wxw40kwk3u8nguyTQH3hx6jmqp"
+    ],
+    [
+        "bc1qtsvlht6730n04f2mpaj5vv8hrledn5n5ug8c79"
+    ],
+    [
+        "tb1dclvmr"
+    ],
+    [
+        "bcrt1q3fqvctqu48wsvggrt09vj0yk2gzzcscdp4h98u"
+    ],
+    [
+        "bc1prklpq7tjcawg89cmwwqr3u5apwav36xa4zz56ady7crsllm6mpnqts7p86"
+    ],
+    [
+        "tb1zkm58zyhxz3ffkfgsyprflg543slsl4c4"
+    ],
+    [
+        "bcrt1snzr5kaypnfhpnjanrhd20fhqcjxm3hfh7dw9fu"
+    ],
+    [
+        "2GgnYKqBGuA2Mm5GnrPsMTZR81xPhNtgMYoFUZngZGiobhCuUpCaTriUHRcgFreEekNdPAR17q8d"
+    ],
+    [
+        "AZEah8d1EK362okRBS66e8SvdtYkrE8tsX"
+    ],
+    [
+        "gep8xr77FyPW6zYP15RiV9W8nL6w2HyHB16cUDakfyDceMA6ZzUdhJjk2LPuLYHnLkBqkRTTi6z"
+    ],
+    [
+        "2NDNP7GY59tTJPZTpbkprhM9SR99Nn5rUs7"
+    ],
+    [
+        "2Csgzy2T287YAjeU5tFtt1nPshBZAUFQi4WtgaWyZGKSBNnKXHy2Tmxo8QK4Mfdds977ShcDWC5o"
+    ],
+    [
+        "Kwjk3Vy6sdXMQDGWJzaWmqFxUNtWZCX1q4F4Kpt8jNNUoWJUUaTY"
+    ],
+    [
+        "Svj8kk98bAS9V4L2crmxakbhmnPm3cJ1tJ4Je4yVzDreU8eSTFURS1SPYv5oWEQD8Q9VBDvx5uF"
+    ],
+    [
+        "KNYsv6v9GtkGeD4WdQnBEJCrPKQm91PTxAbCfXr66LEd4JDmhPWC"
+    ],
+    [
+        "2UJ2H2xvAeXmFKfQwMyDoSdQTTPFMNCT3SsoUafBWKzoGP3NsUK1buEgQZG38viyD53jgMdpqfT7"
+    ],
+    [
+        "6aLMfayKF4TW4ecn5SEc8FExpyJA2peKxYRGZhes6tQ4NTTzuGy"
+    ],
+    [
+        "7VP4FmcebU2thJns9MnXde7LWfuqR5vMizrAuUoq2GcJjzTyA4RHFcPVdZL8PLg1SbpSFdJrvLXoY5"
+    ],
+    [
+        "tc1q5qdvt99uc92jyz663dtdpfpv6nr67ahmgwcpq2"
+    ],
+    [
+        "sys10d3rmtg62h747en5j6fju5g5qyvsransrkty6ghh96pu647wumctejlsngh9pf26cysrys2x2"
+    ],
+    [
+        "tb1323z3lnz7dl3kd0nsuh6xy4he9almzl67anxgg3xdzkaxc9rwntlqdhdzd7"
+    ],
+    [
+        "bcrt1r2gc42sky"
+    ],
+    [
+        "sys1qule2szwzyaq4qy0s3aa4mauucyqt6fewe"
+    ],
+    [
+        "TB1QZY7V0F2AT3308YGGNGN66ULJTCN3RY6F"
+    ],
+    [
+        "bcrt1qjg3cwht92znyw0l4r5rtctmls337nrc7g0ry9drjxmlecjd3atl3fake7c"
+    ],
+    [
+        "sys1qtvm6davyf725wfedc2d5mrgfewqgcrce8gjrpl"
+    ],
+    [
+        "TB1Q3F9WGNXE9ZMTTMDN5VKVKHYZ8Y0LCV72YV7V5LSXTJXEYHNHEHASLYL0TZ"
+    ]
+]
+)json";};
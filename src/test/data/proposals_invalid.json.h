@@ -0,0 +1,19 @@
+#include <string>
+namespace json_tests{
+static const std::string proposals_invalid = R"json(
+[
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3q0sL5k7", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": " sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "7V11XGPxzBWxkiuw15a1Vgk7XT74tyYtCY", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q ", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": " dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean miller 5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493 ", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": -1.0, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493 ", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller- 5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": " http://dashcentral.org/dean-miller-5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493 "},
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller 5493"},
+{"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "STg7iUrEyPbp9bkQxcZ6vt9LJWV7Rxyfyq", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "htt"}
+]
+)json";};
@@ -0,0 +1,30 @@
+#include <string>
+namespace json_tests{
+static const std::string proposals_valid = R"json(
+[
+[
+    {"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+    false
+],
+[
+    {"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qu9dgdg330r6r84g5mw7wqshg04exv2uttmw2elfwx74h5tgntuzs0adkj8", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+    true
+],
+[
+    {"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.12345678, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentral.org/dean-miller-5493"},
+    false
+],
+[
+    {"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentralis.org/dean-miller-5493"},
+    false
+],
+[
+    {"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "sys1qyt3k8ffrj3apzrv6n6c3fqsduxp6egcn76jq9q", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://dashcentralis.org/dean-miller-5493"},
+    false
+],
+[
+    {"end_epoch": 1491368400, "name": "dean-miller-5493", "payment_address": "STg7iUrEyPbp9bkQxcZ6vt9LJWV7Rxyfyq", "payment_amount": 25.75, "start_epoch": 1474261086, "type": 1, "url": "http://[dead:beef:cafe:5417:affe:8FA3:deaf:feed]:/foo/"},
+    false
+]
+]
+)json";};